@@ -10,5 +10,5 @@
 #define FT_VOX_COLLISION_CHECK			1
 #define FT_VOX_DYNAMIC_VISIBILITY   	0
 #define FT_VOX_MULTILAYER_HEIGHT_NOISE	1
-
-#define FT_VOX_SEED						21
\ No newline at end of file
+#define FT_VOX_FAR_TERRAIN				1
+#define FT_VOX_OCCLUSION_CULLING		1
\ No newline at end of file
@@ -19,6 +19,7 @@ using				std::is_base_of;
 #include <stack>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 using				std::array;
 using				std::vector;
@@ -28,6 +29,7 @@ using				std::queue;
 using				std::stack;
 using				std::multimap;
 using				std::unordered_map;
+using				std::unordered_set;
 
 #pragma endregion
 
@@ -67,6 +69,9 @@ using				std::ifstream;
 using				std::ofstream;
 using				std::stringstream;
 using				std::ios;
+using				std::fixed;
+using				std::hex;
+using				std::dec;
 
 #pragma endregion
 
@@ -102,18 +107,37 @@ namespace			chrono = std::chrono;
 
 #pragma endregion
 
+#pragma region File system
+
+#include <filesystem>
+
+namespace			filesystem = std::filesystem;
+
+#pragma endregion
+
 #pragma region Other classes
 
 #include <iterator>
+#include <algorithm>
 #include <functional>
 #include <optional>
 #include <limits>
+#include <tuple>
+#include <cstdint>
 
 using				std::function;
+using				std::greater;
 using				std::optional;
 using				std::nullopt;
 using				std::numeric_limits;
 using				std::pair;
+using				std::tuple;
+using				std::int64_t;
+using				std::int32_t;
+using				std::int16_t;
+using				std::uint8_t;
+using				std::uint32_t;
+using				std::uint64_t;
 
 #pragma endregion
 
@@ -121,10 +145,15 @@ using				std::pair;
 
 using				std::make_pair;
 using				std::to_string;
+using				std::stoi;
 using				std::min;
 using				std::max;
 using				std::clamp;
 using				std::hash;
 using				std::make_optional;
+using				std::sort;
+using				std::find;
+using				std::copy;
+using				std::move;
 
 #pragma endregion
\ No newline at end of file
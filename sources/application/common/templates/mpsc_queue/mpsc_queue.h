@@ -0,0 +1,69 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+// Lock-free queue for many producer threads and one consumer thread.
+// Producers only exchange the head, consumer only moves the tail, so neither side ever waits.
+template					<typename type>
+class						mpsc_queue
+{
+public :
+							mpsc_queue()
+	{
+		tail = new node();
+		head.store(tail);
+	}
+
+							~mpsc_queue()
+	{
+		while (pop())
+			;
+		delete tail;
+	}
+
+							mpsc_queue(const mpsc_queue &) = delete;
+	mpsc_queue				&operator = (const mpsc_queue &) = delete;
+
+	void					push(const type &value)
+	{
+		auto				new_node = new node();
+		node				*previous_node;
+
+		new_node->value = value;
+		previous_node = head.exchange(new_node, std::memory_order_acq_rel);
+		previous_node->next.store(new_node, std::memory_order_release);
+	}
+
+	// Should be called only from consumer thread
+	optional<type>			pop()
+	{
+		node				*next_node = tail->next.load(std::memory_order_acquire);
+		optional<type>		value;
+
+		if (next_node == nullptr)
+			return nullopt;
+
+		value = move(next_node->value);
+		delete tail;
+		tail = next_node;
+
+		return value;
+	}
+
+	// Should be called only from consumer thread
+	bool					is_empty() const
+	{
+		return tail->next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private :
+
+	struct					node
+	{
+		atomic<node *>		next = nullptr;
+		type				value = {};
+	};
+
+	atomic<node *>			head;
+	node					*tail;
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "application/common/imports/std.h"
 
+// One base per notification type, so dispatch is a single virtual call without any type checks
 template			<typename type>
 class 				listener
 {
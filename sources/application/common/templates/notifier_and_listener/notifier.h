@@ -5,38 +5,62 @@
 #include "application/common/defines.h"
 #include "application/common/debug/debug.h"
 
-template			<typename type>
+// Keeps a separate contiguous list of listeners for each notification type,
+// the right list is selected at compile time
+template			<typename ...types>
 class 				notifier
 {
 public :
 
+	template		<typename type>
 	void			subscribe(listener<type> &listener)
 	{
-		listeners.emplace((size_t)&listener, ref(listener));
+		get_listeners<type>().push_back(&listener);
 	}
 
+	template		<typename type>
 	void			unsubscribe(listener<type> &listener)
 	{
-		listeners.erase((size_t)&listener);
+		auto		&listeners = get_listeners<type>();
+		auto		iterator = find(listeners.begin(), listeners.end(), &listener);
+
+		if (iterator == listeners.end())
+			return;
+
+		*iterator = listeners.back();
+		listeners.pop_back();
 	}
 
 #if FT_VOX_DEBUG
 	void			check_number_of_listeners(int expected) const
 	{
-		debug::check_critical(listeners.size() == expected, "[notifier] Validation on number of listeners failed");
+		const auto	number_of_listeners = (std::get<listeners_type<types>>(listeners).size() + ...);
+
+		debug::check_critical(number_of_listeners == expected, "[notifier] Validation on number of listeners failed");
 	}
 #endif
 
 protected :
 
+	template		<typename type>
 	void			notify(const type &notification)
 	{
-		for (const auto &[ptr, listener] : listeners)
-			listener.get().notify(notification);
+		for (auto *listener : get_listeners<type>())
+			listener->notify(notification);
 	}
 
 private :
 
-	using			listeners_type = unordered_map<size_t, reference_wrapper<listener<type>>>;
-	listeners_type	listeners;
+	template		<typename type>
+	using			listeners_type = vector<listener<type> *>;
+
+	tuple<listeners_type<types>...>
+					listeners;
+
+	template		<typename type>
+	listeners_type<type>
+					&get_listeners()
+	{
+		return std::get<listeners_type<type>>(listeners);
+	}
 };
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "application/common/imports/std.h"
 #include "application/common/debug/debug.h"
+#include "application/common/templates/singleton/singleton_settings.h"
 
 template						<typename type>
 class							singleton
@@ -16,6 +17,7 @@ public :
 
 		debug::check_critical(instance == nullptr, "[application::singleton] Instance is already constructed");
 		instance = make_shared<type>();
+		raw_instance = instance.get();
 
 		instance_as_singleton = dynamic_pointer_cast<singleton>(instance);
 		debug::check_critical(instance_as_singleton != nullptr, "[application::singleton] Can't construct instance");
@@ -23,11 +25,22 @@ public :
 		instance_as_singleton->when_constructed();
 	}
 
-	static auto					get_instance()
+	// Raw pointer is returned, so hot paths don't touch reference counter.
+	// Instance is owned by this class and lives until the end of program.
+	static type					*get_instance()
 	{
-		if (instance == nullptr)
+		if (raw_instance == nullptr)
 			construct();
 
+		if (singleton_settings::should_copy_shared_pointer)
+			return shared_ptr<type>(instance).get();
+
+		return raw_instance;
+	}
+
+	static shared_ptr<type>		get_shared_instance()
+	{
+		get_instance();
 		return instance;
 	}
 
@@ -39,4 +52,7 @@ private :
 
 	static inline
 	shared_ptr<type>			instance;
+
+	static inline
+	type						*raw_instance = nullptr;
 };
\ No newline at end of file
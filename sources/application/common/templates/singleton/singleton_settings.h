@@ -0,0 +1,8 @@
+#pragma once
+
+struct							singleton_settings
+{
+	// Makes get_instance copy shared pointer on every call, like previous access path did.
+	// Only benchmarks turn it on, so both paths can be compared on real workloads.
+	static inline bool			should_copy_shared_pointer = false;
+};
\ No newline at end of file
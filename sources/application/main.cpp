@@ -1,10 +1,24 @@
 #include "engine/launcher/launcher.h"
+#include "engine/main/system/window/window/window.h"
+#include "engine/extensions/utilities/clock_check/clock_check.h"
+#include "engine/extensions/utilities/clock_check/clock_check_settings.h"
 #include "game/launcher/launcher.h"
+#include "game/benchmark/determinism_check/determinism_check.h"
+#include "game/benchmark/determinism_check/determinism_check_settings.h"
+#include "game/benchmark/micro_benchmark/micro_benchmark.h"
+#include "game/benchmark/micro_benchmark/micro_benchmark_settings.h"
+#include "game/pregenerator/world_pregenerator/world_pregenerator.h"
+#include "game/pregenerator/world_pregenerator/world_pregenerator_settings.h"
 
-int					main()
+int					main(int argc, char **argv)
 {
+	game::launcher::parse_arguments(engine::launcher::parse_arguments(argc, argv));
 	engine::launcher::construct_mandatory_objects();
 
+	// Clock check only needs engine, so it runs before game is set up
+	if (engine::utilities::clock_check_settings::is_enabled)
+		return engine::utilities::clock_check::run() ? 0 : 1;
+
 	game::launcher::setup_layouts();
 	game::launcher::construct_engine_extension_objects();
 
@@ -12,11 +26,25 @@ int					main()
 	game::launcher::setup_texture_atlas();
 	game::launcher::setup_biomes();
 
+	// Checks and pre-generation don't need player or rendering, so application exits right after them
+	if (game::determinism_check_settings::is_enabled)
+		return game::determinism_check::run() ? 0 : 1;
+	if (game::micro_benchmark_settings::is_enabled)
+		return game::micro_benchmark::run() ? 0 : 1;
+	if (game::world_pregenerator_settings::is_enabled)
+		return game::world_pregenerator::run() ? 0 : 1;
+
 	game::launcher::construct_player();
 
 	game::launcher::setup_ui();
 
 	engine::launcher::start_game_loop();
 
-	return 0;
+	if (engine::window::is_headless())
+	{
+		engine::launcher::print_statistics();
+		game::launcher::print_statistics();
+	}
+
+	return game::launcher::did_succeed() ? 0 : 1;
 }
\ No newline at end of file
@@ -28,10 +28,94 @@ shared_ptr<symbol>		font::find_symbol(char task) const
 	return result->second;
 }
 
+void					font::use_atlas(bool state)
+{
+	atlas->use(state);
+}
+
+// All symbols are packed into single atlas, so text can be rendered with one texture
 void					font::build_map()
 {
+	std::map<char, vector<unsigned char>>
+						bitmaps;
+	std::map<char, ivec2>
+						offsets;
+
+	ivec2				cursor = ivec2(0);
+	ivec2				atlas_size = ivec2(0);
+	int					row_height = 0;
+
 	for (int i = first_char_code; i <= last_char_code; i++)
-		map.emplace(i, build_symbol(static_cast<char>(i)));
+	{
+		const auto		character = static_cast<char>(i);
+		const auto		symbol = build_symbol(character);
+		const auto		&bitmap = face->glyph->bitmap;
+		auto			&pixels = bitmaps[character];
+
+		for (int row = 0; row < (int)bitmap.rows; row++)
+			pixels.insert(pixels.end(), bitmap.buffer + row * bitmap.pitch, bitmap.buffer + row * bitmap.pitch + bitmap.width);
+
+		if (cursor.x + symbol->size.x > max_atlas_width)
+		{
+			cursor.x = 0;
+			cursor.y += row_height + atlas_padding;
+			row_height = 0;
+		}
+
+		offsets[character] = cursor;
+		cursor.x += symbol->size.x + atlas_padding;
+		row_height = max(row_height, symbol->size.y);
+		atlas_size.x = max(atlas_size.x, cursor.x);
+
+		map.emplace(character, symbol);
+	}
+
+	atlas_size.y = cursor.y + row_height;
+
+	vector<unsigned char>
+						atlas_pixels(atlas_size.x * atlas_size.y, 0);
+
+	for (const auto &[character, symbol] : map)
+	{
+		const auto		&offset = offsets[character];
+		const auto		&pixels = bitmaps[character];
+
+		for (int row = 0; row < symbol->size.y; row++)
+		{
+			copy
+			(
+				pixels.begin() + row * symbol->size.x,
+				pixels.begin() + (row + 1) * symbol->size.x,
+				atlas_pixels.begin() + (offset.y + row) * atlas_size.x + offset.x
+			);
+		}
+
+		symbol->texture_min = vec2(offset) / vec2(atlas_size);
+		symbol->texture_max = vec2(offset + symbol->size) / vec2(atlas_size);
+	}
+
+	atlas = make_unique<texture>();
+	atlas->use(true);
+
+	glTexImage2D
+	(
+		GL_TEXTURE_2D,
+		0,
+		GL_RED,
+		atlas_size.x,
+		atlas_size.y,
+		0,
+		GL_RED,
+		GL_UNSIGNED_BYTE,
+		atlas_pixels.data()
+	);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	atlas->use(false);
 }
 
 shared_ptr<symbol>		font::build_symbol(char task)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "engine/main/rendering/texture/texture/texture.h"
+
 #include "application/common/imports/std.h"
 #include "application/common/imports/glm.h"
 #include "application/common/imports/freetype.h"
@@ -28,6 +30,8 @@ public :
 
 	shared_ptr<symbol>				find_symbol(char task) const;
 
+	void							use_atlas(bool state);
+
 private :
 
 	void							build_map();
@@ -36,9 +40,14 @@ private :
 	static constexpr int			first_char_code = 32;
 	static constexpr int			last_char_code = 126;
 
+	static constexpr int			max_atlas_width = 1024;
+	static constexpr int			atlas_padding = 1;
+
 	FT_Face							face = nullptr;
 	map<char, shared_ptr<symbol>>	map;
 
+	unique_ptr<texture>				atlas;
+
 	vec3							color = vec3(1.f);
 };
 
@@ -1,7 +1,5 @@
 #pragma once
 
-#include "engine/main/rendering/texture/texture/texture.h"
-
 #include "application/common/imports/opengl.h"
 #include "application/common/imports/glm.h"
 #include "application/common/imports/freetype.h"
@@ -26,10 +24,11 @@ public :
 	ivec2						get_bearing() const;
 	int							get_advance() const;
 
-	bool 						has_texture() const;
-	void						use_texture(bool state);
+	// Area of symbol in font atlas
+	vec2						get_texture_min() const;
+	vec2						get_texture_max() const;
 
-	void 						render(const ivec2 &position);
+	bool 						is_empty() const;
 
 private :
 
@@ -37,9 +36,8 @@ private :
 	ivec2						bearing;
 	int							advance;
 
-	shared_ptr<font>			font;
-	unique_ptr<texture>			texture;
+	vec2						texture_min = vec2(0.f);
+	vec2						texture_max = vec2(0.f);
 
-	static
-	unique_ptr<engine::texture>	extract_free_type_bitmap(const FT_Bitmap &bitmap);
+	shared_ptr<font>			font;
 };
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "symbol_renderer.h"
 
 #include "engine/main/rendering/model/model/model.h"
-#include "engine/extensions/ui/font/symbol/symbol.h"
+#include "engine/extensions/ui/font/font/font.h"
 #include "engine/main/system/window/window/window.h"
 
 using namespace		engine;
@@ -17,63 +17,29 @@ using namespace		engine::ui;
 	uniform_texture = program->create_uniform<int>("uniform_texture");
 
 	program->use(true);
-	uniform_projection.upload(ortho(0.f, (float)window::get_size().x, (float)window::get_size().y, 0.f));
 	uniform_texture.upload(0);
 	program->use(false);
-
-	vector<GLfloat>	vertices =
-	{
-		1.f, 1.f, 0.0f,
-		1.f, 0.f, 0.0f,
-		0.f, 0.f, 0.0f,
-		0.f, 1.f, 0.0f
-	};
-
-	vector<GLfloat>	texture_coordinates =
-	{
-		1.0f, 1.0f,
-		1.0f, 0.0f,
-		0.0f, 0.0f,
-		0.0f, 1.0f
-	};
-
-	vector<GLuint>	indices =
-	{
-		0, 1, 3,
-		1, 2, 3
-	};
-
-	model = make_shared<::model>();
-
-	model->use(true);
-
-	model->add_vbo(3, vertices);
-	model->add_vbo(2, texture_coordinates);
-	model->add_ebo(indices);
-
-	model->use(false);
 }
 
-void				symbol_renderer::render(symbol &symbol, const ivec2 &position)
+void				symbol_renderer::render(const engine::model &model, font &font)
 {
 	auto			instance = get_instance();
 
-	if (not symbol.has_texture())
-		return;
-
-	instance->model->set_translation(vec3(position.x, position.y, 0));
-	instance->model->set_scaling(vec3(symbol.get_size().x, symbol.get_size().y, 0));
-
 	instance->program->use(true);
-	instance->model->use(true);
 
-	symbol.use_texture(true);
+	if (const auto window_size = window::get_size(); window_size != instance->projection_size)
+	{
+		instance->uniform_projection.upload(ortho(0.f, (float)window_size.x, (float)window_size.y, 0.f));
+		instance->projection_size = window_size;
+	}
 
-	instance->uniform_transformation.upload(instance->model->get_transformation());
-	instance->model->render();
+	model.use(true);
+	font.use_atlas(true);
 
-	symbol.use_texture(false);
+	instance->uniform_transformation.upload(model.get_transformation());
+	model.render();
 
-	instance->model->use(false);
+	font.use_atlas(false);
+	model.use(false);
 	instance->program->use(false);
 }
\ No newline at end of file
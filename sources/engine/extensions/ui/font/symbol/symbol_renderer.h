@@ -10,7 +10,7 @@ namespace						engine
 
 	namespace					ui
 	{
-		class					symbol;
+		class					font;
 		class					symbol_renderer;
 	}
 }
@@ -23,12 +23,11 @@ public :
 								symbol_renderer();
 								~symbol_renderer() override = default;
 
-	static void					render(symbol &symbol, const ivec2 &position);
+	// Model is expected to contain quads of all symbols in window coordinates
+	static void					render(const engine::model &model, font &font);
 
 private :
 
-	shared_ptr<engine::model>	model;
-
 	inline static const string	path_to_vertex_shader = "resources/shaders/symbol.vertex.glsl";
 	inline static const string	path_to_fragment_shader = "resources/shaders/symbol.fragment.glsl";
 
@@ -37,6 +36,9 @@ private :
 	engine::uniform<mat4>		uniform_projection;
 	engine::uniform<mat4>		uniform_transformation;
 	engine::uniform<int>		uniform_texture;
+
+	// Projection is uploaded again only when window is resized
+	ivec2						projection_size = ivec2(-1);
 };
 
 
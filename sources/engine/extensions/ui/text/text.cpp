@@ -2,6 +2,8 @@
 
 #include "engine/extensions/ui/font/font/font.h"
 #include "engine/extensions/ui/font/symbol/symbol.h"
+#include "engine/extensions/ui/font/symbol/symbol_renderer.h"
+#include "engine/main/rendering/model/model/model.h"
 #include "engine/main/system/window/window/window.h"
 #include "engine/main/system/window/window_tools/window_tools.h"
 
@@ -39,7 +41,11 @@ ivec2				text::get_size() const
 
 void				text::set_string(const std::string &string)
 {
+	if (this->string == string)
+		return ;
+
 	this->string = string;
+	is_model_outdated = true;
 	recalculate_size();
 }
 
@@ -51,27 +57,19 @@ void 				text::when_rendered()
 		return;
 	}
 
-	ivec2			position_iterator = position;
-	vec3			position_of_symbol = vec3(0.f);
-
-	position_iterator = window_tools::invert_y(position_iterator);
-	for (char character : string)
-	{
-		auto		symbol = font->find_symbol(character);
-
-		if (!symbol)
-			continue;
+	if (is_model_outdated)
+		rebuild_model();
 
-		auto		bearing = symbol->get_bearing();
-		auto		advance = symbol->get_advance();
+	if (model == nullptr)
+		return;
 
-		position_of_symbol.x = (float)(position_iterator.x + bearing.x);
-		position_of_symbol.y = (float)(position_iterator.y - bearing.y);
+	// Quads are built around origin and placed here, so they follow window height after resize
+	const auto			translation = vec3(window_tools::invert_y(position), 0.f);
 
-		symbol->render(position_of_symbol);
+	if (model->get_translation() != translation)
+		model->set_translation(translation);
 
-		position_iterator.x += advance;
-	}
+	symbol_renderer::render(*model, *font);
 }
 
 void				text::recalculate_size()
@@ -93,4 +91,56 @@ void				text::recalculate_size()
 	}
 
 	size = new_size;
+}
+
+void				text::rebuild_model()
+{
+	vector<GLfloat>	vertices;
+	vector<GLfloat>	texture_coordinates;
+	vector<GLuint>	indices;
+
+	ivec2			position_iterator = ivec2(0);
+
+	for (char character : string)
+	{
+		auto		symbol = font->find_symbol(character);
+
+		if (!symbol)
+			continue;
+
+		if (not symbol->is_empty())
+		{
+			const auto	min = vec2(position_iterator.x + symbol->get_bearing().x, position_iterator.y - symbol->get_bearing().y);
+			const auto	max = min + vec2(symbol->get_size());
+			const auto	texture_min = symbol->get_texture_min();
+			const auto	texture_max = symbol->get_texture_max();
+			const auto	offset = (GLuint)(vertices.size() / 3);
+
+			vertices.insert(vertices.end(), {max.x, max.y, 0.f, max.x, min.y, 0.f, min.x, min.y, 0.f, min.x, max.y, 0.f});
+			texture_coordinates.insert
+			(
+				texture_coordinates.end(),
+				{texture_max.x, texture_max.y, texture_max.x, texture_min.y, texture_min.x, texture_min.y, texture_min.x, texture_max.y}
+			);
+			indices.insert(indices.end(), {offset + 0, offset + 1, offset + 3, offset + 1, offset + 2, offset + 3});
+		}
+
+		position_iterator.x += symbol->get_advance();
+	}
+
+	is_model_outdated = false;
+	model = nullptr;
+
+	if (indices.empty())
+		return ;
+
+	model = make_shared<engine::model>();
+
+	model->use(true);
+
+	model->add_vbo(3, vertices);
+	model->add_vbo(2, texture_coordinates);
+	model->add_ebo(indices);
+
+	model->use(false);
 }
\ No newline at end of file
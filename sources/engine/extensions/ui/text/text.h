@@ -5,6 +5,11 @@
 
 #include "application/common/imports/glm.h"
 
+namespace				engine
+{
+	class				model;
+}
+
 namespace				engine::ui
 {
 	class 				font;
@@ -33,8 +38,12 @@ private :
 	shared_ptr<font>	font;
 	ivec2				size;
 
+	shared_ptr<model>	model;
+	bool				is_model_outdated = true;
+
 	void				when_rendered() override;
 	void				recalculate_size();
+	void				rebuild_model();
 };
 
 
@@ -0,0 +1,76 @@
+#include "clock_check.h"
+
+#include "application/common/debug/debug.h"
+
+#include "engine/main/system/time/clock/clock.h"
+#include "engine/main/system/time/timer/timer.h"
+#include "engine/extensions/utilities/fps_counter/fps_counter.h"
+
+using namespace			engine;
+using namespace			engine::utilities;
+
+bool					clock_check::run()
+{
+	clock::use_fake_time(clock::ticks_per_second);
+
+	const bool			did_timer_pass = check_timer();
+	const bool			did_fps_counter_pass = check_fps_counter();
+
+	clock::use_real_time();
+
+	cout << (did_timer_pass and did_fps_counter_pass ? "All clock checks passed" : "Some clock checks failed") << endl;
+
+	return did_timer_pass and did_fps_counter_pass;
+}
+
+bool					clock_check::check_timer()
+{
+	const timer			timer(1.f);
+	bool				result = true;
+
+	result &= expect(timer.is_running() and not timer.did_finish(), "Timer runs right after start");
+
+	clock::advance_fake_time(clock::ticks_per_second / 2);
+	result &= expect(timer.is_running() and not timer.did_finish(), "Timer runs in the middle of duration");
+
+	// Timer still runs at the exact moment of its finish and finishes right after it
+	clock::advance_fake_time(clock::ticks_per_second / 2);
+	result &= expect(timer.is_running() and not timer.did_finish(), "Timer runs at the end of duration");
+
+	clock::advance_fake_time(1);
+	result &= expect(not timer.is_running() and timer.did_finish(), "Timer finishes after duration");
+
+	return result;
+}
+
+bool					clock_check::check_fps_counter()
+{
+	constexpr int		frames_per_second = 30;
+
+	const auto			counter = make_shared<fps_counter>();
+	bool				result = true;
+
+	// Default timer is already finished, so first update starts the first second
+	counter->update();
+	result &= expect(counter->get_fps() == 0, "Fps counter is zero before first second");
+
+	for (int frame = 0; frame < frames_per_second; frame++)
+	{
+		clock::advance_fake_time(clock::ticks_per_second / frames_per_second);
+		counter->update();
+	}
+
+	result &= expect(counter->get_fps() == 0, "Fps counter isn't updated before second ends");
+
+	clock::advance_fake_time(clock::ticks_per_second / frames_per_second);
+	counter->update();
+	result &= expect(counter->get_fps() == frames_per_second, "Fps counter counts frames of one second");
+
+	return result;
+}
+
+bool					clock_check::expect(bool statement, const string &name)
+{
+	cout << (statement ? "[OK] " : "[FAILED] ") << name << endl;
+	return debug::check(statement, "[engine::clock_check] Check failed : " + name);
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						engine::utilities
+{
+	class						clock_check;
+}
+
+// Drives timer and fps counter through fake time and compares their results with expected ones.
+// Fake time is advanced step by step, so results don't depend on speed of machine.
+class							engine::utilities::clock_check
+{
+public :
+
+	// Returns true if all checks pass
+	static bool					run();
+
+private :
+
+	static bool					check_timer();
+	static bool					check_fps_counter();
+
+	static bool					expect(bool statement, const string &name);
+};
\ No newline at end of file
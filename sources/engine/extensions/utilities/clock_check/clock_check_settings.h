@@ -0,0 +1,11 @@
+#pragma once
+
+namespace						engine::utilities
+{
+	struct 						clock_check_settings;
+}
+
+struct							engine::utilities::clock_check_settings
+{
+	static inline bool			is_enabled = false;
+};
\ No newline at end of file
@@ -1,14 +1,70 @@
 #include "launcher.h"
 
+#include "application/common/debug/debug.h"
+
 #include "engine/main/system/window/window/window.h"
 #include "engine/main/system/input/input.h"
 #include "engine/main/rendering/layout/layout/layout.h"
 #include "engine/main/rendering/layout/layout_manager/layout_manager.h"
 #include "engine/main/rendering/camera/camera/camera.h"
+#include "engine/main/rendering/null_gl/null_gl.h"
 #include "engine/main/processor/processor.h"
+#include "engine/main/processor/processor_settings.h"
+#include "engine/main/system/window/window/window_settings.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/memory_usage/memory_usage.h"
+#include "engine/extensions/utilities/clock_check/clock_check_settings.h"
 
 using namespace		engine;
 
+vector<string>		launcher::parse_arguments(int argc, char **argv)
+{
+	vector<string>	other_arguments;
+
+	for (int index = 1; index < argc; index++)
+	{
+		const string	argument = argv[index];
+		const bool		has_value = index + 1 < argc;
+
+		if (argument == "--headless")
+			window_settings::is_headless = true;
+		else if (argument == "--frames" and has_value)
+		{
+			if (const auto frames = parse_number(argv[++index]); frames)
+				processor_settings::max_number_of_frames = *frames;
+		}
+		else if (argument == "--clock-check")
+		{
+			window_settings::is_headless = true;
+			utilities::clock_check_settings::is_enabled = true;
+		}
+		else if (argument == "--profile" and has_value)
+			profiler_settings::dump_path = argv[++index];
+		else
+			other_arguments.push_back(argument);
+	}
+
+	return other_arguments;
+}
+
+optional<int>		launcher::parse_number(const string &argument)
+{
+	try
+	{
+		size_t		length = 0;
+		const int	number = stoi(argument, &length);
+
+		if (length == argument.size())
+			return number;
+	}
+	catch (const std::exception &)
+	{
+	}
+
+	debug::raise_warning("[engine::launcher] Expected number, but got '" + argument + "'");
+	return nullopt;
+}
+
 void				launcher::construct_mandatory_objects()
 {
 	// We need layout manager to be constructed first
@@ -25,4 +81,29 @@ void				launcher::construct_mandatory_objects()
 void				launcher::start_game_loop()
 {
 	processor::execute();
+}
+
+void				launcher::print_statistics()
+{
+	const int		number_of_frames = processor::get_number_of_frames();
+	const float		run_time = processor::get_run_time();
+
+	cout.precision(2);
+	cout << fixed;
+
+	cout << "Frames : " << number_of_frames << " in " << run_time << " s";
+	cout << " (" << (run_time > 0.f ? (float)number_of_frames / run_time : 0.f) << " fps)" << endl;
+
+	cout << "Frame ms : " << profiler::get_average_frame_time() * 1000.f;
+	cout << " / max " << profiler::get_max_frame_time() * 1000.f;
+	cout << " (last " << profiler::get_number_of_recorded_frames() << " frames)" << endl;
+
+	if (window_settings::is_headless)
+	{
+		cout << "GL calls : " << null_gl::get_number_of_calls();
+		cout << ", uploaded " << (float)null_gl::get_number_of_uploaded_bytes() / (1024.f * 1024.f) << " MB";
+		cout << ", " << null_gl::get_number_of_live_objects() << " live objects" << endl;
+	}
+
+	cout << "Peak memory : " << memory_usage::get_peak() << " MB" << endl;
 }
\ No newline at end of file
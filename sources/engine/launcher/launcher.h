@@ -1,5 +1,7 @@
 #pragma once
 
+#include "application/common/imports/std.h"
+
 namespace			engine
 {
 	class 			launcher;
@@ -9,6 +11,17 @@ class				engine::launcher
 {
 public :
 
+	// Supported options : --headless, --frames <number>, --profile <path to csv>, --clock-check
+	// Arguments that aren't recognized are returned, so game can parse them
+	static vector<string>
+					parse_arguments(int argc, char **argv);
+
+	// Warns and returns nothing, if argument isn't a number
+	static optional<int>
+					parse_number(const string &argument);
+
 	static void 	construct_mandatory_objects();
 	static void 	start_game_loop();
+
+	static void		print_statistics();
 };
\ No newline at end of file
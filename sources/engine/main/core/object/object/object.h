@@ -7,11 +7,17 @@ namespace					engine
 {
 	class					object;
 	class 					object_manipulator;
+	class 					processor;
+	class 					object_storage;
+	class 					layout_manager;
 }
 
 class						engine::object : public enable_shared_from_this<object>
 {
 	friend class 			engine::object_manipulator;
+	friend class 			engine::processor;
+	friend class 			engine::object_storage;
+	friend class 			engine::layout_manager;
 
 public :
 
@@ -56,4 +62,9 @@ private :
 
 	enum state				state;
 	string 					layout;
+
+	// Positions in containers of object_storage and layout_manager, used for swap-and-pop removal
+	int						storage_slot = -1;
+	int						layout_handle = -1;
+	int						layout_slot = -1;
 };
\ No newline at end of file
@@ -20,7 +20,7 @@ protected :
 
 	void				when_constructed() final
 	{
-		auto 			instance = singleton<type>::get_instance();
+		auto 			instance = singleton<type>::get_shared_instance();
 
 		object_storage::add(instance);
 		object_manipulator::initialize(instance);
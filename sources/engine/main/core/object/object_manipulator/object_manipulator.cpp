@@ -1,6 +1,7 @@
 #include "object_manipulator.h"
 
 #include "engine/main/core/object/object/object.h"
+#include "engine/main/processor/processor.h"
 
 using namespace	engine;
 
@@ -8,24 +9,28 @@ void			object_manipulator::initialize(const shared_ptr<object> &object)
 {
 	object->when_initialized();
 	object->state = object::state::initialized;
+	processor::invalidate();
 }
 
 void			object_manipulator::deinitialize(const shared_ptr<object> &object)
 {
 	object->when_deinitialized();
 	object->state = object::state::deinitialized;
+	processor::invalidate();
 }
 
 void			object_manipulator::activate(const shared_ptr<object> &object)
 {
 	object->when_activated();
 	object->state = object::state::activated;
+	processor::invalidate();
 }
 
 void			object_manipulator::deactivate(const shared_ptr<object> &object)
 {
 	object->when_deactivated();
 	object->state = object::state::deactivated;
+	processor::invalidate();
 }
 
 void			object_manipulator::render(const shared_ptr<object> &object)
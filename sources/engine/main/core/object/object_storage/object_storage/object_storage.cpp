@@ -1,39 +1,51 @@
 #include "object_storage.h"
 
+#include "engine/main/core/object/object/object.h"
 #include "engine/main/core/object/object_manipulator/object_manipulator.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_was_added.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_was_removed.h"
 
 using namespace		engine;
 
 					object_storage::~object_storage()
 {
 	for (const auto &object : objects)
-		object_manipulator::deinitialize(object.second);
+		object_manipulator::deinitialize(object);
 }
 
 void				object_storage::add(const shared_ptr<object> &object)
 {
 	auto			instance = get_instance();
 
-	instance->objects.emplace((intptr_t)object.get(), object);
+	object->storage_slot = (int)instance->objects.size();
+	instance->objects.push_back(object);
 	instance->notify(object_was_added(object));
 }
 
 void				object_storage::remove(const shared_ptr<object> &object)
 {
+	auto			instance = get_instance();
+	auto			&objects = instance->objects;
+	const int		slot = object->storage_slot;
+
+	debug::check_critical(slot >= 0 and objects[slot] == object, "[object_storage] Object is not stored");
+
 	do_remove(object);
-	get_instance()->objects.erase((intptr_t)object.get());
+
+	objects[slot] = objects.back();
+	objects[slot]->storage_slot = slot;
+	objects.pop_back();
+
+	object->storage_slot = -1;
 }
 
 void				object_storage::clean()
 {
-	auto			instance = get_instance();
+	auto			&objects = get_instance()->objects;
 
-	for (auto iterator = instance->objects.cbegin(); iterator != instance->objects.cend();)
+	while (not objects.empty())
 	{
-		do_remove(iterator->second);
-		instance->objects.erase(iterator++);
+		do_remove(objects.back());
+		objects.back()->storage_slot = -1;
+		objects.pop_back();
 	}
 }
 
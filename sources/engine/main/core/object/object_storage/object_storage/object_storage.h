@@ -1,6 +1,7 @@
 #pragma once
 
-#include "engine/main/core/object/object_storage/object_storage_event/object_storage_event.h"
+#include "engine/main/core/object/object_storage/object_storage_event/object_was_added.h"
+#include "engine/main/core/object/object_storage/object_storage_event/object_was_removed.h"
 
 #include "application/common/templates/singleton/singleton.h"
 #include "application/common/templates/notifier_and_listener/notifier.h"
@@ -14,9 +15,9 @@ namespace			engine
 
 class				engine::object_storage final :
 						public singleton<engine::object_storage>,
-						public notifier<object_storage_event>
+						public notifier<object_was_added, object_was_removed>
 {
-	using			data_type = unordered_map<intptr_t, shared_ptr<object>>;
+	using			data_type = vector<shared_ptr<object>>;
 
 public :
 					object_storage() = default;
@@ -21,7 +21,7 @@ public :
 protected :
 
 	explicit			object_storage_event(const shared_ptr<object> &object) : object(object) {}
-	virtual				~object_storage_event() = default;
+						~object_storage_event() = default;
 
 private :
 
@@ -13,5 +13,4 @@ class				engine::object_was_removed : public object_storage_event
 public :
 
 	explicit		object_was_removed(const shared_ptr<engine::object> &object) : object_storage_event(object) {}
-					~object_was_removed() override = default;
 };
\ No newline at end of file
@@ -5,26 +5,76 @@
 #include "engine/main/system/window/window/window.h"
 #include "engine/main/system/input/input.h"
 #include "engine/main/system/time/timer/timer.h"
+#include "engine/main/system/time/clock/clock.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/profiler/scoped_timer/scoped_timer.h"
 #include "engine/main/rendering/layout/layout/layout.h"
 #include "engine/main/rendering/layout/layout_manager/layout_manager.h"
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
 #include "engine/main/processor/processor_settings.h"
 
 using namespace	engine;
 
+				processor::processor()
+{
+	phase_sections[(int)phase::input] = profiler::register_section("Input");
+	phase_sections[(int)phase::activation] = profiler::register_section("Activation");
+	phase_sections[(int)phase::updating] = profiler::register_section("Updating");
+	phase_sections[(int)phase::rendering] = profiler::register_section("Rendering");
+}
+
 void			processor::execute()
 {
+	const auto	instance = get_instance();
+	const auto	run_start = clock::now();
+
 	do
 	{
-		process_input();
-		process_activation();
-		process_updating();
-		process_rendering();
+		const auto	start = clock::now();
+
+		process_phase(phase::input, process_input);
+		process_phase(phase::activation, process_activation);
+		process_phase(phase::updating, process_updating);
+		process_phase(phase::rendering, process_rendering);
+
+		profiler::finish_frame(clock::get_seconds_since(start));
+
+		instance->number_of_frames++;
+		if (instance->number_of_frames == processor_settings::max_number_of_frames)
+			window::close();
 	}
 	while (not window::is_closed());
 
+	instance->run_time = clock::get_seconds_since(run_start);
+
+	if (not profiler_settings::dump_path.empty())
+		profiler::dump(profiler_settings::dump_path);
+
 	object_storage::clean();
 }
 
+void			processor::invalidate()
+{
+	get_instance()->should_rebuild = true;
+}
+
+int				processor::get_number_of_frames()
+{
+	return get_instance()->number_of_frames;
+}
+
+float			processor::get_run_time()
+{
+	return get_instance()->run_time;
+}
+
+void			processor::process_phase(phase phase, void (*function)())
+{
+	scoped_timer	timer(get_instance()->phase_sections[(int)phase]);
+
+	function();
+}
+
 void			processor::process_input()
 {
 	static bool	empty_polygons = false;
@@ -32,7 +82,7 @@ void			processor::process_input()
 	input::reset_keys();
 	input::update_mouse();
 
-	glfwPollEvents();
+	window::poll_events();
 
 	if (input::is_pressed(input::key::escape))
 		window::close();
@@ -45,38 +95,71 @@ void			processor::process_input()
 
 void			processor::process_activation()
 {
-	for (const auto &layout : layout_manager::get_layouts())
-	for (auto &object : layout->get_objects())
-	{
-		if (object->get_state() == object::state::initialized)
-			object->activate();
-	}
+	auto		instance = get_instance();
+
+	instance->rebuild_if_needed();
+
+	// Activation changes state of object, so arrays will be rebuilt before updating
+	for (auto *object : instance->objects_to_activate)
+		object->activate();
 }
 
 void			processor::process_updating()
 {
-	for (const auto &layout : layout_manager::get_layouts())
-	for (auto &object : layout->get_objects())
-	{
-		if (object->get_state() == object::state::activated)
-			object->update();
-	}
+	auto		instance = get_instance();
+
+	instance->rebuild_if_needed();
+
+	for (const auto &[layout, objects] : instance->active_objects)
+	for (auto *object : objects)
+		object->when_updated();
 }
 
 void			processor::process_rendering()
 {
+	auto		instance = get_instance();
+
+	instance->rebuild_if_needed();
 	window::clear(processor_settings::background);
 
-	for (const auto &layout : layout_manager::get_layouts())
+	for (const auto &[layout, objects] : instance->active_objects)
 	{
 		layout->apply_options();
 
-		for (auto &object : layout->get_objects())
+		for (auto *object : objects)
+			object->when_rendered();
+	}
+
+	window::swap_buffers();
+	gl_call_counter::finish_frame();
+}
+
+void			processor::rebuild_if_needed()
+{
+	if (not should_rebuild)
+		return;
+
+	const auto	&layouts = layout_manager::get_layouts();
+	auto		layout_iterator = layouts.begin();
+
+	objects_to_activate.clear();
+	active_objects.resize(layouts.size());
+
+	for (auto &[layout, objects] : active_objects)
+	{
+		layout = layout_iterator->get();
+		objects.clear();
+
+		for (const auto &object : layout->get_objects())
 		{
-			if (object->get_state() == object::state::activated)
-				object->render();
+			if (object->get_state() == object::state::initialized)
+				objects_to_activate.push_back(object.get());
+			else if (object->get_state() == object::state::activated)
+				objects.push_back(object.get());
 		}
+
+		layout_iterator++;
 	}
 
-	window::swap_buffers();
+	should_rebuild = false;
 }
\ No newline at end of file
@@ -1,11 +1,9 @@
 #pragma once
 
 #include "application/common/templates/singleton/singleton.h"
-#include "application/common/templates/notifier_and_listener/listener.h"
 #include "application/common/imports/std.h"
 
 #include "engine/main/core/object/object/object.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_storage_event.h"
 
 namespace			engine
 {
@@ -19,16 +17,56 @@ namespace			engine
 class 				engine::processor final : public singleton<processor>
 {
 public :
-					processor() = default;
+
+	enum class		phase
+	{
+		input,
+		activation,
+		updating,
+		rendering
+	};
+
+	static constexpr
+	int				number_of_phases = 4;
+
+					processor();
 					~processor() override = default;
 
 	static void		execute();
 
+	// Should be called whenever state or layout of any object changes
+	static void		invalidate();
+
+	static int		get_number_of_frames();
+
+	// Duration of last execution in seconds
+	static float	get_run_time();
+
 private :
 
+	using			objects_type = vector<object *>;
+
+	// Dense arrays of raw pointers, objects themselves are owned by layouts
+	objects_type	objects_to_activate;
+	vector<pair<const layout *, objects_type>>
+					active_objects;
+
+	bool			should_rebuild = true;
+
+	int				number_of_frames = 0;
+	float			run_time = 0.f;
+
+	// Sections of profiler
+	array<int, number_of_phases>
+					phase_sections;
+
+	static void		process_phase(phase phase, void (*function)());
+
 	static void		process_input();
 
 	static void		process_activation();
 	static void		process_updating();
 	static void		process_rendering();
+
+	void			rebuild_if_needed();
 };
\ No newline at end of file
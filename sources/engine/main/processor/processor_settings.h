@@ -7,5 +7,8 @@ namespace					engine
 	struct					processor_settings
 	{
 		static inline vec3	background = vec3(0.72f, 0.85f, 1.f);
+
+		// Window is closed after this number of frames, zero means no limit
+		static inline int	max_number_of_frames = 0;
 	};
 }
\ No newline at end of file
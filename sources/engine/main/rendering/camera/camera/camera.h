@@ -8,7 +8,8 @@
 #include "engine/main/core/object/object/object.h"
 #include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
 #include "engine/main/rendering/camera/direction/direction.h"
-#include "engine/main/rendering/camera/camera_event/camera_event.h"
+#include "engine/main/rendering/camera/camera_event/camera_position_changed_event.h"
+#include "engine/main/rendering/camera/camera_event/camera_direction_changed_event.h"
 #include "engine/main/rendering/camera/camera/camera_settings.h"
 
 namespace				engine
@@ -19,7 +20,7 @@ namespace				engine
 class					engine::camera :
 							public engine::object,
 							public engine::unique_object_constructor<engine::camera>,
-							public notifier<engine::camera_event>
+							public notifier<engine::camera_position_changed_event, engine::camera_direction_changed_event>
 {
 public :
 						camera();
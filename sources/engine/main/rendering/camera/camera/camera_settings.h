@@ -1,5 +1,6 @@
 #pragma once
 
+#include "application/common/defines.h"
 #include "application/common/imports/glm.h"
 
 namespace					engine
@@ -12,7 +13,11 @@ struct						engine::camera_settings
 	static constexpr float	rotation_speed = 0.05f;
 
 	static inline float		near_plane = 0.05f;
+#if FT_VOX_FAR_TERRAIN
+	static inline float		far_plane = 1000.f;
+#else
 	static inline float		far_plane = 500.f;
+#endif
 
 	static inline float 	default_fov = 50.f;
 	static inline float 	minimum_fov = 40.f;
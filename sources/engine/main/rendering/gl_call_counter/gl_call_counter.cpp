@@ -0,0 +1,28 @@
+#include "gl_call_counter.h"
+
+using namespace			engine;
+
+void					gl_call_counter::register_call(type type, int count)
+{
+	current_frame[(int)type] += count;
+}
+
+int						gl_call_counter::get_calls(type type)
+{
+	return last_frame[(int)type];
+}
+
+int						gl_call_counter::get_total_calls()
+{
+	int					total = 0;
+
+	for (auto calls : last_frame)
+		total += calls;
+	return total;
+}
+
+void					gl_call_counter::finish_frame()
+{
+	last_frame = current_frame;
+	current_frame.fill(0);
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace				engine
+{
+	class				gl_call_counter;
+}
+
+// Counts GL calls issued by rendering wrappers, so batching can be verified frame by frame
+class					engine::gl_call_counter
+{
+public :
+
+	enum class			type
+	{
+		binding,
+		uniform,
+		draw
+	};
+
+	static constexpr
+	int					number_of_types = 3;
+
+						gl_call_counter() = delete;
+
+	static void			register_call(type type, int count = 1);
+
+	static int			get_calls(type type);
+	static int			get_total_calls();
+
+	static void			finish_frame();
+
+private :
+
+	static inline
+	array<int, number_of_types>
+						current_frame = {};
+
+	static inline
+	array<int, number_of_types>
+						last_frame = {};
+};
\ No newline at end of file
@@ -1,10 +1,6 @@
 #include "layout_manager.h"
 
-#include "application/common/utilities/type_utility.h"
-
 #include "engine/main/core/object/object_storage/object_storage/object_storage.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_was_added.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_was_removed.h"
 
 using namespace					engine;
 
@@ -13,71 +9,96 @@ const layout_manager::data_type	&layout_manager::get_layouts()
 	return get_instance()->data;
 }
 
-void		 					layout_manager::add(const string &name, int options)
+int		 					layout_manager::add(const string &name, int options)
 {
-	get_instance()->data.push_back(make_shared<layout>(name, options));
+	auto						instance = get_instance();
+
+	// Default layout already exists after construction, so adding known name just returns its handle
+	if (const int existing_handle = get_handle(name); existing_handle >= 0)
+		return existing_handle;
+
+	const int					handle = (int)instance->data.size();
+
+	instance->data.push_back(make_shared<layout>(name, options));
+	instance->handles.emplace(name, handle);
+	return handle;
 }
 
 shared_ptr<layout>				layout_manager::find(const string &name)
 {
-	for (const auto &layout : get_instance()->data)
+	const int					handle = get_handle(name);
+
+	if (handle < 0)
 	{
-		if (layout->name == name)
-			return layout;
+		debug::raise_error("[layout_manager] Layout not found");
+		return nullptr;
 	}
 
-	debug::raise_error("[layout_manager] Layout not found");
-	return nullptr;
+	return get(handle);
+}
+
+int								layout_manager::get_handle(const string &name)
+{
+	const auto					&handles = get_instance()->handles;
+	const auto					iterator = handles.find(name);
+
+	return iterator != handles.end() ? iterator->second : -1;
+}
+
+shared_ptr<layout>				layout_manager::get(int handle)
+{
+	return get_instance()->data[handle];
 }
 
 void 							layout_manager::when_constructed()
 {
 	add(default_layout);
-	object_storage::get_instance()->subscribe(*this);
+	object_storage::get_instance()->subscribe<object_was_added>(*this);
+	object_storage::get_instance()->subscribe<object_was_removed>(*this);
+}
+
+void							layout_manager::when_notified(const object_was_added &event)
+{
+	add(event.get_object());
 }
 
-void							layout_manager::when_notified(const object_storage_event &pocket)
+void							layout_manager::when_notified(const object_was_removed &event)
 {
-	if (type_utility::is_of_type<object_was_added>(pocket))
-		get_instance()->add(pocket.get_object());
-	else if (type_utility::is_of_type<object_was_removed>(pocket))
-		get_instance()->remove(pocket.get_object());
-	else
-		debug::raise_warning("[layout_manager] Can't parse 'object_storage_event'");
+	remove(event.get_object());
 }
 
 void							layout_manager::add(const shared_ptr<object> &object)
 {
-	for (const auto &layout : data)
+	const int					handle = get_handle(object->get_layout());
+
+	if (handle < 0)
 	{
-		if (layout->name == object->get_layout())
-		{
-			layout->objects.push_back(object);
-			return;
-		}
+		debug::raise_warning("[layout_manager::add] Can't add object to layout '" + object->get_layout() + "'");
+		return;
 	}
 
-	debug::raise_warning("[layout_manager::add] Can't add object to layout '" + object->get_layout() + "'");
+	auto						&objects = data[handle]->objects;
+
+	object->layout_handle = handle;
+	object->layout_slot = (int)objects.size();
+	objects.push_back(object);
 }
 
 void							layout_manager::remove(const shared_ptr<object> &object)
 {
-	for (const auto &layout : data)
+	if (object->layout_handle < 0)
 	{
-		if (layout->name == object->get_layout())
-		{
-			for (auto iterator = layout->objects.begin(); iterator != layout->objects.end(); iterator++)
-			{
-				if (*iterator == object)
-				{
-					layout->objects.erase(iterator);
-					break;
-				}
-			}
-
-			return;
-		}
+		debug::raise_warning("[layout_manager::remove] Can't remove object from layout '" + object->get_layout() + "'");
+		return;
 	}
 
-	debug::raise_warning("[layout_manager::add] Can't remove object from layout '" + object->get_layout() + "'");
+	auto						&objects = data[object->layout_handle]->objects;
+	const int					slot = object->layout_slot;
+
+	objects[slot] = objects.back();
+	objects[slot]->layout_slot = slot;
+	objects.pop_back();
+
+	object->layout_handle = -1;
+	object->layout_slot = -1;
 }
\ No newline at end of file
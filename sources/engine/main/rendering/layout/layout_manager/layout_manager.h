@@ -1,7 +1,8 @@
 #pragma once
 
 #include "engine/main/rendering/layout/layout/layout.h"
-#include "engine/main/core/object/object_storage/object_storage_event/object_storage_event.h"
+#include "engine/main/core/object/object_storage/object_storage_event/object_was_added.h"
+#include "engine/main/core/object/object_storage/object_storage_event/object_was_removed.h"
 
 #include "application/common/templates/singleton/singleton.h"
 #include "application/common/templates/notifier_and_listener/listener.h"
@@ -14,25 +15,31 @@ namespace						engine
 
 class							engine::layout_manager :
 									public singleton<layout_manager>,
-									public listener<object_storage_event>
+									public listener<object_was_added>,
+									public listener<object_was_removed>
 {
-	using						data_type = list<shared_ptr<layout>>;
+	using						data_type = vector<shared_ptr<layout>>;
 
 public :
 
 	static const data_type		&get_layouts();
 
-	static void 				add(const string &name, int options = 0);
+	static int	 				add(const string &name, int options = 0);
 	static shared_ptr<layout>	find(const string &name);
 
+	static int					get_handle(const string &name);
+	static shared_ptr<layout>	get(int handle);
+
 private :
 
 	static constexpr const char	*default_layout = "System";
 
 	data_type					data;
+	unordered_map<string, int>	handles;
 
 	void 						when_constructed() override;
-	void						when_notified(const object_storage_event &pocket) override;
+	void						when_notified(const object_was_added &event) override;
+	void						when_notified(const object_was_removed &event) override;
 
 	void						add(const shared_ptr<object> &object);
 	void						remove(const shared_ptr<object> &object);
@@ -1,5 +1,7 @@
 #include "model.h"
 
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
+
 #include "application/common/debug/debug.h"
 
 using namespace		engine;
@@ -68,6 +70,7 @@ void				model::set_rotation(const vec3 &value)
 void				model::use(bool state) const
 {
 	glBindVertexArray(state ? vao : 0);
+	gl_call_counter::register_call(gl_call_counter::type::binding);
 }
 
 void				model::render() const
@@ -82,6 +85,8 @@ void				model::render() const
 			glDrawElements(GL_LINES, number_of_indices, GL_UNSIGNED_INT, nullptr);
 			break ;
 	}
+
+	gl_call_counter::register_call(gl_call_counter::type::draw);
 }
 
 void				model::add_vbo(int dimension, const vector<GLfloat> &data)
@@ -128,6 +133,24 @@ void				model::add_ebo(const vector<GLuint> &indices)
 	number_of_indices = indices.size();
 }
 
+void				model::update_ebo(const vector<GLuint> &indices)
+{
+	if (number_of_indices != (int)indices.size())
+	{
+		debug::raise_warning("[model] Can't update EBO with different number of indices");
+		return;
+	}
+
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbos.back());
+	glBufferSubData(
+		GL_ELEMENT_ARRAY_BUFFER,
+		0,
+		indices.size() * sizeof(indices[0]),
+		indices.data());
+	glBindVertexArray(0);
+}
+
 void 				model::recalculate_transformation()
 {
 	vec3 			rotation;
@@ -34,6 +34,7 @@ public:
 
 	void				add_vbo(int dimension, const vector<GLfloat> &data);
 	void				add_ebo(const vector<GLuint> &indices);
+	void				update_ebo(const vector<GLuint> &indices);
 
 	void				use(bool state) const;
 
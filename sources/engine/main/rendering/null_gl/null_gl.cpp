@@ -0,0 +1,310 @@
+#include "null_gl.h"
+
+#include "application/common/imports/opengl.h"
+
+using namespace				engine;
+
+// Stubs must have exact signatures of GL functions, so they are gathered here and not in class
+struct						engine::null_gl_functions
+{
+	static void APIENTRY	active_texture(GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	attach_shader(GLuint, GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	bind_buffer(GLenum, GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	bind_texture(GLenum, GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	bind_vertex_array(GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	blend_func(GLenum, GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	buffer_data(GLenum, GLsizeiptr size, const void *, GLenum)
+	{
+		null_gl::register_upload(size);
+	}
+
+	static void APIENTRY	buffer_sub_data(GLenum, GLintptr, GLsizeiptr size, const void *)
+	{
+		null_gl::register_upload(size);
+	}
+
+	static void APIENTRY	clear(GLbitfield)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	clear_color(GLfloat, GLfloat, GLfloat, GLfloat)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	compile_shader(GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static GLuint APIENTRY	create_program()
+	{
+		GLuint				name;
+
+		null_gl::generate_names(1, &name);
+		return name;
+	}
+
+	static GLuint APIENTRY	create_shader(GLenum)
+	{
+		GLuint				name;
+
+		null_gl::generate_names(1, &name);
+		return name;
+	}
+
+	static void APIENTRY	delete_objects(GLsizei number, const GLuint *)
+	{
+		null_gl::delete_names(number);
+	}
+
+	static void APIENTRY	delete_object(GLuint)
+	{
+		null_gl::delete_names(1);
+	}
+
+	static void APIENTRY	disable(GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	draw_elements(GLenum, GLsizei, GLenum, const void *)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	enable(GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	enable_vertex_attrib_array(GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	generate_objects(GLsizei number, GLuint *names)
+	{
+		null_gl::generate_names(number, names);
+	}
+
+	static void APIENTRY	generate_mipmap(GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	get_info_log(GLuint, GLsizei size, GLsizei *length, GLchar *log)
+	{
+		null_gl::register_call();
+
+		if (length != nullptr)
+			*length = 0;
+		if (size > 0)
+			log[0] = '\0';
+	}
+
+	// Compilation and linking always succeed
+	static void APIENTRY	get_status(GLuint, GLenum, GLint *parameters)
+	{
+		null_gl::register_call();
+		*parameters = GL_TRUE;
+	}
+
+	static GLint APIENTRY	get_uniform_location(GLuint, const GLchar *)
+	{
+		null_gl::register_call();
+		return 0;
+	}
+
+	static void APIENTRY	link_program(GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	pixel_store(GLenum, GLint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	polygon_mode(GLenum, GLenum)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	shader_source(GLuint, GLsizei, const GLchar *const *, const GLint *)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	tex_image_2d
+							(
+								GLenum, GLint, GLint,
+								GLsizei width, GLsizei height,
+								GLint, GLenum format, GLenum, const void *
+							)
+	{
+		const int			channels = format == GL_RED ? 1 : format == GL_RGB ? 3 : 4;
+
+		null_gl::register_upload((int64_t)width * height * channels);
+	}
+
+	static void APIENTRY	tex_parameter(GLenum, GLenum, GLint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	uniform_1f(GLint, GLfloat)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	uniform_1i(GLint, GLint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	uniform_3f(GLint, GLfloat, GLfloat, GLfloat)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	uniform_4f(GLint, GLfloat, GLfloat, GLfloat, GLfloat)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	uniform_matrix_4fv(GLint, GLsizei, GLboolean, const GLfloat *)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	use_program(GLuint)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	vertex_attrib_pointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void *)
+	{
+		null_gl::register_call();
+	}
+
+	static void APIENTRY	viewport(GLint, GLint, GLsizei, GLsizei)
+	{
+		null_gl::register_call();
+	}
+};
+
+void						null_gl::load()
+{
+	glActiveTexture = null_gl_functions::active_texture;
+	glAttachShader = null_gl_functions::attach_shader;
+	glBindBuffer = null_gl_functions::bind_buffer;
+	glBindTexture = null_gl_functions::bind_texture;
+	glBindVertexArray = null_gl_functions::bind_vertex_array;
+	glBlendFunc = null_gl_functions::blend_func;
+	glBufferData = null_gl_functions::buffer_data;
+	glBufferSubData = null_gl_functions::buffer_sub_data;
+	glClear = null_gl_functions::clear;
+	glClearColor = null_gl_functions::clear_color;
+	glCompileShader = null_gl_functions::compile_shader;
+	glCreateProgram = null_gl_functions::create_program;
+	glCreateShader = null_gl_functions::create_shader;
+	glDeleteBuffers = null_gl_functions::delete_objects;
+	glDeleteProgram = null_gl_functions::delete_object;
+	glDeleteShader = null_gl_functions::delete_object;
+	glDeleteTextures = null_gl_functions::delete_objects;
+	glDeleteVertexArrays = null_gl_functions::delete_objects;
+	glDisable = null_gl_functions::disable;
+	glDrawElements = null_gl_functions::draw_elements;
+	glEnable = null_gl_functions::enable;
+	glEnableVertexAttribArray = null_gl_functions::enable_vertex_attrib_array;
+	glGenBuffers = null_gl_functions::generate_objects;
+	glGenTextures = null_gl_functions::generate_objects;
+	glGenVertexArrays = null_gl_functions::generate_objects;
+	glGenerateMipmap = null_gl_functions::generate_mipmap;
+	glGetProgramInfoLog = null_gl_functions::get_info_log;
+	glGetProgramiv = null_gl_functions::get_status;
+	glGetShaderInfoLog = null_gl_functions::get_info_log;
+	glGetShaderiv = null_gl_functions::get_status;
+	glGetUniformLocation = null_gl_functions::get_uniform_location;
+	glLinkProgram = null_gl_functions::link_program;
+	glPixelStorei = null_gl_functions::pixel_store;
+	glPolygonMode = null_gl_functions::polygon_mode;
+	glShaderSource = null_gl_functions::shader_source;
+	glTexImage2D = null_gl_functions::tex_image_2d;
+	glTexParameteri = null_gl_functions::tex_parameter;
+	glUniform1f = null_gl_functions::uniform_1f;
+	glUniform1i = null_gl_functions::uniform_1i;
+	glUniform3f = null_gl_functions::uniform_3f;
+	glUniform4f = null_gl_functions::uniform_4f;
+	glUniformMatrix4fv = null_gl_functions::uniform_matrix_4fv;
+	glUseProgram = null_gl_functions::use_program;
+	glVertexAttribPointer = null_gl_functions::vertex_attrib_pointer;
+	glViewport = null_gl_functions::viewport;
+}
+
+int64_t						null_gl::get_number_of_calls()
+{
+	return number_of_calls;
+}
+
+int64_t						null_gl::get_number_of_uploaded_bytes()
+{
+	return number_of_uploaded_bytes;
+}
+
+int							null_gl::get_number_of_live_objects()
+{
+	return number_of_live_objects;
+}
+
+void						null_gl::generate_names(int number, unsigned int *names)
+{
+	register_call();
+
+	for (int index = 0; index < number; index++)
+		names[index] = ++last_name;
+	number_of_live_objects += number;
+}
+
+void						null_gl::delete_names(int number)
+{
+	register_call();
+	number_of_live_objects -= number;
+}
+
+void						null_gl::register_call()
+{
+	number_of_calls++;
+}
+
+void						null_gl::register_upload(int64_t bytes)
+{
+	register_call();
+	number_of_uploaded_bytes += bytes;
+}
\ No newline at end of file
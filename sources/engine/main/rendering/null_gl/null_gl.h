@@ -0,0 +1,48 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace				engine
+{
+	class				null_gl;
+	struct				null_gl_functions;
+}
+
+// Replaces GL functions used by engine with stubs that only record what was requested.
+// Rendering code runs unchanged, but no context or GPU is needed.
+class					engine::null_gl
+{
+public :
+
+						null_gl() = delete;
+
+	static void			load();
+
+	static int64_t		get_number_of_calls();
+	static int64_t		get_number_of_uploaded_bytes();
+
+	// GL objects that were created, but not deleted yet
+	static int			get_number_of_live_objects();
+
+private :
+
+	static inline
+	int64_t				number_of_calls = 0;
+
+	static inline
+	int64_t				number_of_uploaded_bytes = 0;
+
+	static inline
+	int					number_of_live_objects = 0;
+
+	static inline
+	unsigned int		last_name = 0;
+
+	static void			generate_names(int number, unsigned int *names);
+	static void			delete_names(int number);
+
+	static void			register_call();
+	static void			register_upload(int64_t bytes);
+
+	friend struct		null_gl_functions;
+};
\ No newline at end of file
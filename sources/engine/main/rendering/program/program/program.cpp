@@ -1,6 +1,7 @@
 #include "program.h"
 
 #include "engine/main/rendering/program/shader/shader.h"
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
 
 #include "application/common/debug/debug.h"
 
@@ -35,6 +36,7 @@ using namespace		engine;
 void				program::use(bool state)
 {
 	glUseProgram(state ? value : 0);
+	gl_call_counter::register_call(gl_call_counter::type::binding);
 }
 
 void				program::log_error() const
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
+
 #include "application/common/debug/debug.h"
 #include "application/common/imports/opengl.h"
 #include "application/common/imports/glm.h"
@@ -43,6 +45,8 @@ public :
 			glUniformMatrix4fv(value, 1, GL_FALSE, value_ptr(data));
 		else
 			debug::raise_error("[uniform] Unknown uniform type");
+
+		gl_call_counter::register_call(gl_call_counter::type::uniform);
 	}
 
 private :
@@ -1,5 +1,7 @@
 #include "texture.h"
 
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
+
 using namespace		engine;
 
 					texture::texture()
@@ -27,4 +29,5 @@ void 				texture::use(bool state)
 {
 	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_2D, state ? _value : 0);
+	gl_call_counter::register_call(gl_call_counter::type::binding, 2);
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "memory_usage.h"
+
+#include <sys/resource.h>
+
+using namespace		engine;
+
+float				memory_usage::get_peak()
+{
+	rusage			usage = {};
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	// Linux reports kilobytes, macOS reports bytes
+#if __APPLE__
+	return (float)usage.ru_maxrss / (1024.f * 1024.f);
+#else
+	return (float)usage.ru_maxrss / 1024.f;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+namespace			engine
+{
+	class			memory_usage;
+}
+
+class				engine::memory_usage
+{
+public :
+
+					memory_usage() = delete;
+
+	// Peak resident set size of process in megabytes
+	static float	get_peak();
+};
\ No newline at end of file
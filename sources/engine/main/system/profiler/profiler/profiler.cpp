@@ -0,0 +1,141 @@
+#include "profiler.h"
+
+#include "application/common/debug/debug.h"
+
+using namespace			engine;
+
+int						profiler::register_section(const string &name, section_type type)
+{
+	for (int index = 0; index < (int)sections.size(); index++)
+	{
+		if (sections[index].name == name)
+			return index;
+	}
+
+	sections.push_back({ name, type });
+	return (int)sections.size() - 1;
+}
+
+void					profiler::register_time(int section, float seconds)
+{
+	sections[section].current_time += seconds;
+}
+
+void					profiler::register_value(int section, float value)
+{
+	sections[section].current_time = value;
+}
+
+void					profiler::finish_frame(float frame_time)
+{
+	for (auto &section : sections)
+	{
+		section.times[next_frame] = section.current_time;
+		section.current_time = 0.f;
+	}
+
+	frame_times[next_frame] = frame_time;
+
+	next_frame = (next_frame + 1) % number_of_frames;
+	number_of_recorded_frames = min(number_of_recorded_frames + 1, number_of_frames);
+}
+
+int						profiler::get_number_of_sections()
+{
+	return (int)sections.size();
+}
+
+const string			&profiler::get_section_name(int section)
+{
+	return sections[section].name;
+}
+
+enum profiler::section_type
+						profiler::get_section_type(int section)
+{
+	return sections[section].type;
+}
+
+float					profiler::get_average_time(int section)
+{
+	return get_average(sections[section].times);
+}
+
+float					profiler::get_max_time(int section)
+{
+	return get_max(sections[section].times);
+}
+
+float					profiler::get_average_frame_time()
+{
+	return get_average(frame_times);
+}
+
+float					profiler::get_max_frame_time()
+{
+	return get_max(frame_times);
+}
+
+int						profiler::get_number_of_recorded_frames()
+{
+	return number_of_recorded_frames;
+}
+
+float					profiler::get_frame_time(int index)
+{
+	return frame_times[get_ring_index(index)];
+}
+
+float					profiler::get_time(int section, int index)
+{
+	return sections[section].times[get_ring_index(index)];
+}
+
+void					profiler::dump(const string &path)
+{
+	ofstream			file(path);
+
+	if (not debug::check(file.is_open(), "[engine::profiler] Can't open file '" + path + "'"))
+		return;
+
+	file << "frame,frame_time";
+	for (const auto &section : sections)
+		file << "," << section.name;
+	file << "\n";
+
+	for (int index = 0; index < number_of_recorded_frames; index++)
+	{
+		const int		ring_index = get_ring_index(index);
+
+		file << index << "," << frame_times[ring_index];
+		for (const auto &section : sections)
+			file << "," << section.times[ring_index];
+		file << "\n";
+	}
+}
+
+int						profiler::get_ring_index(int index)
+{
+	return (next_frame - number_of_recorded_frames + index + number_of_frames) % number_of_frames;
+}
+
+float					profiler::get_average(const ring_type &ring)
+{
+	float				sum = 0.f;
+
+	if (number_of_recorded_frames == 0)
+		return 0.f;
+
+	for (int index = 0; index < number_of_recorded_frames; index++)
+		sum += ring[get_ring_index(index)];
+	return sum / (float)number_of_recorded_frames;
+}
+
+float					profiler::get_max(const ring_type &ring)
+{
+	float				result = 0.f;
+
+	for (int index = 0; index < number_of_recorded_frames; index++)
+		result = max(result, ring[get_ring_index(index)]);
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+#include "engine/main/system/profiler/profiler/profiler_settings.h"
+
+namespace				engine
+{
+	class				profiler;
+}
+
+// Keeps timings of named sections for the last few frames. Main thread only.
+class					engine::profiler
+{
+public :
+
+	static constexpr
+	int					number_of_frames = profiler_settings::number_of_frames;
+
+	enum class			section_type
+	{
+		time,
+		value
+	};
+
+						profiler() = delete;
+
+	// Returns existing section if name is already registered
+	static int			register_section(const string &name, section_type type = section_type::time);
+	static void			register_time(int section, float seconds);
+
+	// Value sections keep the last value set during frame, e.g. sizes of queues
+	static void			register_value(int section, float value);
+
+	static void			finish_frame(float frame_time);
+
+	static int			get_number_of_sections();
+	static const string	&get_section_name(int section);
+	static section_type	get_section_type(int section);
+
+	static float		get_average_time(int section);
+	static float		get_max_time(int section);
+
+	static float		get_average_frame_time();
+	static float		get_max_frame_time();
+
+	// Index 0 is the oldest recorded frame
+	static int			get_number_of_recorded_frames();
+	static float		get_frame_time(int index);
+	static float		get_time(int section, int index);
+
+	static void			dump(const string &path);
+
+private :
+
+	using				ring_type = array<float, number_of_frames>;
+
+	struct				section
+	{
+		string			name;
+		section_type	type = section_type::time;
+		float			current_time = 0.f;
+		ring_type		times = {};
+	};
+
+	static inline
+	vector<section>		sections;
+
+	static inline
+	ring_type			frame_times = {};
+
+	static inline
+	int					next_frame = 0;
+
+	static inline
+	int					number_of_recorded_frames = 0;
+
+	static int			get_ring_index(int index);
+
+	static float		get_average(const ring_type &ring);
+	static float		get_max(const ring_type &ring);
+};
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace					engine
+{
+	struct					profiler_settings
+	{
+		static constexpr
+		int					number_of_frames = 240;
+
+		// If not empty, all recorded frames are written to this file when processor stops
+		static inline string
+							dump_path = "";
+	};
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#include "scoped_timer.h"
+
+#include "engine/main/system/profiler/profiler/profiler.h"
+
+using namespace			engine;
+
+						scoped_timer::scoped_timer(int section) :
+							section(section),
+							start(clock::now())
+{}
+
+						scoped_timer::~scoped_timer()
+{
+	profiler::register_time(section, clock::get_seconds_since(start));
+}
\ No newline at end of file
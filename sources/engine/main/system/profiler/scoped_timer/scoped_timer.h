@@ -0,0 +1,27 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+#include "engine/main/system/time/clock/clock.h"
+
+namespace						engine
+{
+	class						scoped_timer;
+}
+
+// Adds time between construction and destruction to profiler section
+class							engine::scoped_timer
+{
+public :
+
+	explicit					scoped_timer(int section);
+								~scoped_timer();
+
+								scoped_timer(const scoped_timer &) = delete;
+	scoped_timer				&operator = (const scoped_timer &) = delete;
+
+private :
+
+	const int					section;
+	const clock::ticks			start;
+};
\ No newline at end of file
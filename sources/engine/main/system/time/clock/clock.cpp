@@ -0,0 +1,42 @@
+#include "clock.h"
+
+using namespace				engine;
+
+clock::ticks				clock::now()
+{
+	if (is_fake)
+		return fake_time;
+
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+float						clock::to_seconds(ticks value)
+{
+	return (float)((double)value / (double)ticks_per_second);
+}
+
+clock::ticks				clock::from_seconds(float value)
+{
+	return (ticks)((double)value * (double)ticks_per_second);
+}
+
+float						clock::get_seconds_since(ticks start)
+{
+	return to_seconds(now() - start);
+}
+
+void						clock::use_fake_time(ticks start)
+{
+	fake_time = start;
+	is_fake = true;
+}
+
+void						clock::advance_fake_time(ticks delta)
+{
+	fake_time += delta;
+}
+
+void						clock::use_real_time()
+{
+	is_fake = false;
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace					engine
+{
+	class					clock;
+}
+
+// Monotonic engine time in integer nanoseconds, doesn't depend on window or GL context.
+// Fake time can be installed, so code relying on time can be driven step by step.
+class						engine::clock
+{
+public :
+
+	using					ticks = int64_t;
+
+	static constexpr ticks	ticks_per_second = 1'000'000'000;
+
+							clock() = delete;
+
+	static ticks			now();
+
+	static float			to_seconds(ticks value);
+	static ticks			from_seconds(float value);
+
+	static float			get_seconds_since(ticks start);
+
+	static void				use_fake_time(ticks start = 0);
+	static void				advance_fake_time(ticks delta);
+	static void				use_real_time();
+
+private :
+
+	static inline
+	atomic<bool>			is_fake = false;
+
+	static inline
+	atomic<ticks>			fake_time = 0;
+};
\ No newline at end of file
@@ -14,15 +14,15 @@ using namespace		engine;
 
 bool 				timer::is_running() const
 {
-	return (float)glfwGetTime() <= finish_time;
+	return clock::now() <= finish_time;
 }
 
 bool 				timer::did_finish() const
 {
-	return (float)glfwGetTime() > finish_time;
+	return clock::now() > finish_time;
 }
 
-float				timer::get_finish_time(float duration)
+clock::ticks		timer::get_finish_time(float duration)
 {
-	return (float)glfwGetTime() + duration;
+	return clock::now() + clock::from_seconds(duration);
 }
\ No newline at end of file
@@ -1,8 +1,9 @@
 #pragma once
 
-#include "application/common/imports/opengl.h"
 #include "application/common/imports/std.h"
 
+#include "engine/main/system/time/clock/clock.h"
+
 namespace			engine
 {
 	class			timer;
@@ -21,7 +22,8 @@ public :
 
 private :
 
-	float			finish_time;
+	clock::ticks	finish_time;
 
-	static float 	get_finish_time(float duration);
+	static clock::ticks
+					get_finish_time(float duration);
 };
\ No newline at end of file
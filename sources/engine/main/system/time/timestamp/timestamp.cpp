@@ -4,12 +4,12 @@ using namespace		engine;
 
 					timestamp::timestamp()
 {
-	value = (float)glfwGetTime();
+	value = clock::now();
 }
 
 float 				timestamp::get_value() const
 {
-	return value;
+	return clock::to_seconds(value);
 }
 
 					timestamp::operator float () const
@@ -19,7 +19,7 @@ float 				timestamp::get_value() const
 
 float				timestamp::operator - (const timestamp &that) const
 {
-	return this->value - that.value;
+	return clock::to_seconds(this->value - that.value);
 }
 
 ostream				&engine::operator << (ostream &stream, const timestamp &timestamp)
@@ -1,7 +1,8 @@
 #pragma once
 
 #include "application/common/imports/std.h"
-#include "application/common/imports/opengl.h"
+
+#include "engine/main/system/time/clock/clock.h"
 
 namespace				engine
 {
@@ -24,5 +25,5 @@ public :
 
 private :
 
-	float				value;
+	clock::ticks		value;
 };
\ No newline at end of file
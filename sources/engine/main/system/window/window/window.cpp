@@ -1,6 +1,8 @@
 #include "window.h"
 
 #include "engine/main/system/input/input.h"
+#include "engine/main/system/window/window/window_settings.h"
+#include "engine/main/rendering/null_gl/null_gl.h"
 
 #include "application/common/defines.h"
 #include "application/common/debug/debug.h"
@@ -9,6 +11,14 @@ using namespace			engine;
 
 						window::window()
 {
+	if (window_settings::is_headless)
+	{
+		size = window_settings::headless_size;
+		null_gl::load();
+		initialize_gl_state();
+		return;
+	}
+
 	glfwInit();
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
@@ -31,20 +41,20 @@ using namespace			engine;
 	debug::check_critical(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress), "[window] Can't load OpenGL functions");
 
 	glfwGetFramebufferSize(glfw_window, &size.x, &size.y);
-	glViewport(0, 0, size.x, size.y);
 
 	glfwSetInputMode(glfw_window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 	glfwSetKeyCallback(glfw_window, input::get_callback_for_keyboard());
 	glfwSetMouseButtonCallback(glfw_window, input::get_callback_for_mouse());
+	glfwSetFramebufferSizeCallback(glfw_window, when_resized);
 
-	glEnable(GL_DEPTH_TEST);
-
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	initialize_gl_state();
 }
 
 						window::~window()
 {
+	if (glfw_window == nullptr)
+		return;
+
 	glfwDestroyWindow(glfw_window);
 	glfwTerminate();
 }
@@ -56,26 +66,53 @@ ivec2					window::get_size()
 
 vec2					window::get_mouse_position()
 {
+	const auto			instance = get_instance();
 	double				x;
 	double				y;
 
-	glfwGetCursorPos(get_instance()->glfw_window, &x, &y);
+	// Mouse stays in the center of headless window
+	if (instance->glfw_window == nullptr)
+		return vec2(instance->size) / 2.f;
+
+	glfwGetCursorPos(instance->glfw_window, &x, &y);
 	return {x, y};
 }
 
+bool					window::is_headless()
+{
+	return get_instance()->glfw_window == nullptr;
+}
+
 bool					window::is_closed()
 {
-	return glfwWindowShouldClose(get_instance()->glfw_window);
+	const auto			instance = get_instance();
+
+	if (instance->glfw_window == nullptr)
+		return instance->should_close;
+
+	return glfwWindowShouldClose(instance->glfw_window);
 }
 
 void 					window::close()
 {
-	glfwSetWindowShouldClose(get_instance()->glfw_window, true);
+	const auto			instance = get_instance();
+
+	if (instance->glfw_window == nullptr)
+		instance->should_close = true;
+	else
+		glfwSetWindowShouldClose(instance->glfw_window, true);
+}
+
+void					window::poll_events()
+{
+	if (not is_headless())
+		glfwPollEvents();
 }
 
 void					window::swap_buffers()
 {
-	glfwSwapBuffers(get_instance()->glfw_window);
+	if (not is_headless())
+		glfwSwapBuffers(get_instance()->glfw_window);
 }
 
 void					window::use_depth_test(bool state)
@@ -90,4 +127,24 @@ void					window::clear(const vec3 &color)
 {
 	glClearColor(color.x, color.y, color.z, 1.f);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void					window::when_resized(GLFWwindow *glfw_window, int width, int height)
+{
+	// Minimized window reports zero size, previous one is kept, so projections stay valid
+	if (width <= 0 or height <= 0)
+		return;
+
+	get_instance()->size = ivec2(width, height);
+	glViewport(0, 0, width, height);
+}
+
+void					window::initialize_gl_state()
+{
+	glViewport(0, 0, size.x, size.y);
+
+	glEnable(GL_DEPTH_TEST);
+
+	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 }
\ No newline at end of file
@@ -20,9 +20,12 @@ public :
 	static ivec2			get_size();
 	static vec2				get_mouse_position();
 
+	static bool				is_headless();
+
 	static bool				is_closed();
 	static void 			close();
 
+	static void 			poll_events();
 	static void 			swap_buffers();
 	static void 			use_depth_test(bool state);
 	static void 			clear(const vec3 &color);
@@ -33,4 +36,9 @@ private :
 
 	ivec2					size = ivec2(-1, -1);
 	GLFWwindow				*glfw_window = nullptr;
+	bool					should_close = false;
+
+	void					initialize_gl_state();
+
+	static void				when_resized(GLFWwindow *glfw_window, int width, int height);
 };
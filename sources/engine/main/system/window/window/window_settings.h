@@ -0,0 +1,13 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+
+namespace					engine
+{
+	struct					window_settings
+	{
+		// Headless window has no GLFW window and GL context, GL functions are replaced with null_gl
+		static inline bool	is_headless = false;
+		static inline ivec2	headless_size = ivec2(1024, 720);
+	};
+}
\ No newline at end of file
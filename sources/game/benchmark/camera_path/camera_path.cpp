@@ -0,0 +1,81 @@
+#include "camera_path.h"
+
+#include "game/benchmark/camera_path/camera_path_settings.h"
+
+using namespace				game;
+
+							camera_path::camera_path(enum type path_type, const vec3 &origin) :
+								path_type(path_type),
+								origin(origin)
+{}
+
+string						camera_path::get_name() const
+{
+	switch (path_type)
+	{
+		case (type::still) :
+			return "still";
+
+		case (type::sprint) :
+			return "sprint";
+
+		case (type::spiral) :
+			return "spiral";
+
+		case (type::teleport) :
+			return "teleport";
+	}
+
+	return "";
+}
+
+int							camera_path::get_number_of_frames() const
+{
+	switch (path_type)
+	{
+		case (type::still) :
+			return 0;
+
+		case (type::sprint) :
+			return camera_path_settings::sprint_number_of_frames;
+
+		case (type::spiral) :
+			return camera_path_settings::spiral_number_of_frames;
+
+		case (type::teleport) :
+			return camera_path_settings::teleport_number_of_jumps * camera_path_settings::teleport_frames_per_jump;
+	}
+
+	return 0;
+}
+
+vec3						camera_path::get_position(int frame) const
+{
+	switch (path_type)
+	{
+		case (type::still) :
+			return origin;
+
+		case (type::sprint) :
+			return origin + vec3((float)frame * camera_path_settings::sprint_step, 0.f, 0.f);
+
+		case (type::spiral) :
+		{
+			const float		angle = (float)frame * camera_path_settings::spiral_angle_step;
+			const float		radius = (float)frame * camera_path_settings::spiral_radius_step;
+
+			return origin + vec3(std::cos(angle) * radius, 0.f, std::sin(angle) * radius);
+		}
+
+		case (type::teleport) :
+		{
+			const int		jump = frame / camera_path_settings::teleport_frames_per_jump + 1;
+			const float		distance = camera_path_settings::teleport_distance;
+
+			// Points go in a zigzag, so every jump lands far from all previous points
+			return origin + vec3((float)jump * distance, 0.f, jump % 2 == 0 ? 0.f : distance);
+		}
+	}
+
+	return origin;
+}
\ No newline at end of file
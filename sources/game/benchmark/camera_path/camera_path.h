@@ -0,0 +1,36 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+namespace					game
+{
+	class					camera_path;
+}
+
+// Deterministic camera trajectory, position is a function of frame index
+class						game::camera_path
+{
+public :
+
+	enum class				type
+	{
+		still,
+		sprint,
+		spiral,
+		teleport
+	};
+
+							camera_path(type path_type, const vec3 &origin);
+							~camera_path() = default;
+
+	string					get_name() const;
+	int						get_number_of_frames() const;
+
+	vec3					get_position(int frame) const;
+
+private :
+
+	type					path_type;
+	vec3					origin;
+};
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+
+namespace						game
+{
+	struct 						camera_path_settings;
+}
+
+struct							game::camera_path_settings
+{
+	// Sprint goes straight along X axis
+	static inline int			sprint_number_of_frames = 1200;
+	static inline float			sprint_step = 1.f;
+
+	// Spiral goes around its origin, moving away from it
+	static inline int			spiral_number_of_frames = 1800;
+	static inline float			spiral_angle_step = 0.01f;
+	static inline float			spiral_radius_step = 0.15f;
+
+	// Teleport jumps between distant points, waiting some frames at each of them
+	static inline int			teleport_number_of_jumps = 4;
+	static inline int			teleport_frames_per_jump = 300;
+	static inline float			teleport_distance = 1000.f;
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include "determinism_check.h"
+
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_surface_generation_task/chunk_surface_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_landscape_generation_task/chunk_landscape_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_decoration_generation_task/chunk_decoration_generation_task.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
+#include "game/benchmark/determinism_check/determinism_check_settings.h"
+
+using namespace				game;
+
+// FNV-1a
+static constexpr uint64_t	hash_offset = 14695981039346656037ull;
+static constexpr uint64_t	hash_prime = 1099511628211ull;
+
+bool						determinism_check::run()
+{
+	const int				number_of_threads = max(2, determinism_check_settings::number_of_threads);
+	const int				region_size = determinism_check_settings::region_radius * 2 + 1;
+
+	auto					start = engine::clock::now();
+	const uint64_t			single_thread_hash = generate_region(1);
+	const float				single_thread_time = engine::clock::get_seconds_since(start);
+
+	start = engine::clock::now();
+	const uint64_t			multiple_threads_hash = generate_region(number_of_threads);
+	const float				multiple_threads_time = engine::clock::get_seconds_since(start);
+
+	const bool				is_deterministic = single_thread_hash == multiple_threads_hash;
+
+	cout.precision(2);
+	cout << fixed;
+
+	cout << "Determinism check : seed " << biome_generator::get_config().seed;
+	cout << ", " << region_size << "x" << region_size << " chunks" << endl;
+
+	cout << "1 thread : " << hex << single_thread_hash << dec << " (" << single_thread_time << " s)" << endl;
+	cout << number_of_threads << " threads : " << hex << multiple_threads_hash << dec << " (" << multiple_threads_time << " s)" << endl;
+
+	cout << (is_deterministic ? "Hashes are equal" : "Hashes are different") << endl;
+
+	return is_deterministic;
+}
+
+uint64_t					determinism_check::generate_region(int number_of_threads)
+{
+	const auto				region = create_region();
+	pending_block_writes	pending_writes;
+
+	// Chunks are interleaved between threads, so neighbor chunks are generated concurrently
+	const auto				run_on_threads = [&region, number_of_threads](const function<void(const shared_ptr<chunk> &)> &work)
+	{
+		vector<future<void>>	futures;
+
+		for (int thread_index = 0; thread_index < number_of_threads; thread_index++)
+		{
+			futures.push_back(async(launch::async, [&region, &work, thread_index, number_of_threads]()
+			{
+				for (int index = thread_index; index < (int)region.size(); index += number_of_threads)
+					work(region[index]);
+			}));
+		}
+
+		for (auto &future : futures)
+			future.wait();
+	};
+
+	run_on_threads([&pending_writes](const shared_ptr<chunk> &chunk) { generate_chunk(chunk, pending_writes); });
+
+	// Same as in streaming, writes are applied after all neighbors of chunk are decorated
+	run_on_threads([&pending_writes](const shared_ptr<chunk> &chunk) { pending_writes.apply(*chunk); });
+
+	uint64_t				hash = hash_offset;
+
+	for (const auto &chunk : region)
+		hash = hash_chunk(*chunk, hash);
+
+	return hash;
+}
+
+vector<shared_ptr<chunk>>	determinism_check::create_region()
+{
+	const int				radius = determinism_check_settings::region_radius;
+	vector<shared_ptr<chunk>>	region;
+
+	for (int x = -radius; x <= radius; x++)
+	for (int z = -radius; z <= radius; z++)
+		region.push_back(make_shared<chunk>(vec3(x * chunk_settings::size[0], 0, z * chunk_settings::size[2])));
+
+	return region;
+}
+
+void						determinism_check::generate_chunk(const shared_ptr<chunk> &chunk, pending_block_writes &pending_writes)
+{
+	chunk_workspace			workspace(chunk);
+
+	chunk_surface_generation_task		surface_task;
+	chunk_landscape_generation_task		landscape_task(biome_generator::get_config());
+	chunk_decoration_generation_task	decoration_task(pending_writes);
+
+	surface_task.execute(workspace);
+	landscape_task.execute(workspace);
+	decoration_task.execute(workspace);
+}
+
+uint64_t					determinism_check::hash_chunk(const chunk &chunk, uint64_t hash)
+{
+	const auto				&surface = chunk.get_surface_map();
+
+	for (int x = 0; x < chunk_settings::size[0]; x++)
+	for (int z = 0; z < chunk_settings::size[2]; z++)
+	{
+		hash = hash_value(surface.get_biome_id(x, z), hash);
+		hash = hash_value(surface.get_interpolated_height(x, z), hash);
+		hash = hash_value(surface.get_final_height(x, z), hash);
+
+		for (int y = 0; y < chunk_settings::size[1]; y++)
+			hash = hash_value((int)chunk.at(x, y, z).get_type(), hash);
+	}
+
+	return hash;
+}
+
+uint64_t					determinism_check::hash_value(int value, uint64_t hash)
+{
+	for (int byte = 0; byte < 4; byte++)
+	{
+		hash ^= (uint64_t)((uint32_t)value >> (byte * 8) & 0xFFu);
+		hash *= hash_prime;
+	}
+
+	return hash;
+}
\ No newline at end of file
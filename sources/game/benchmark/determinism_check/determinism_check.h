@@ -0,0 +1,36 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace							game
+{
+	class							chunk;
+	class							pending_block_writes;
+	class							determinism_check;
+}
+
+// Generates fixed region of chunks with current world config on one thread and then on several threads,
+// and compares hashes of their contents. Equal hashes mean, that generated world depends only on config,
+// but not on order of chunks or on thread, that generated them.
+// Surface, landscape and decoration stages are checked, including structures, that cross chunk borders.
+class								game::determinism_check
+{
+public :
+
+	// Returns true if hashes are equal
+	static bool						run();
+
+	// Hash of region, generated by given number of threads
+	static uint64_t					generate_region(int number_of_threads);
+
+	// Empty chunks of region and stages up to decorations, also used by micro-benchmark
+	static vector<shared_ptr<chunk>>
+									create_region();
+
+	static void						generate_chunk(const shared_ptr<chunk> &chunk, pending_block_writes &pending_writes);
+
+private :
+
+	static uint64_t					hash_chunk(const chunk &chunk, uint64_t hash);
+	static uint64_t					hash_value(int value, uint64_t hash);
+};
\ No newline at end of file
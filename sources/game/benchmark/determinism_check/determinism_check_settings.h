@@ -0,0 +1,19 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						determinism_check_settings;
+}
+
+struct							game::determinism_check_settings
+{
+	static inline bool			is_enabled = false;
+
+	// Region is square of chunks around world origin
+	static inline int			region_radius = 3;
+
+	// Single-threaded run is compared with run, that uses this many threads
+	static inline int			number_of_threads = 8;
+};
\ No newline at end of file
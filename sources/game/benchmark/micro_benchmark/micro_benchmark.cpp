@@ -0,0 +1,387 @@
+#include "micro_benchmark.h"
+
+#include "application/common/debug/debug.h"
+#include "application/common/templates/notifier_and_listener/notifier.h"
+#include "application/common/templates/singleton/singleton_settings.h"
+
+#include "engine/main/system/time/clock/clock.h"
+#include "engine/main/core/object/object/object.h"
+#include "engine/main/rendering/layout/layout_manager/layout_manager.h"
+#include "engine/main/core/object/object_storage/object_storage/object_storage.h"
+
+#include "game/world/texture_atlas/texture_atlas/texture_atlas.h"
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/chunk_geometry_generation_task/chunk_geometry_generation_task.h"
+#include "game/benchmark/determinism_check/determinism_check.h"
+#include "game/benchmark/micro_benchmark/micro_benchmark_settings.h"
+
+using namespace				engine;
+using namespace				game;
+
+bool						micro_benchmark::run()
+{
+	vector<comparison>		comparisons;
+
+	comparisons.push_back(measure_texture_lookups());
+	comparisons.push_back(measure_singleton_access());
+	comparisons.push_back(measure_geometry());
+	comparisons.push_back(measure_notifications());
+
+	const auto				[adding, removing] = measure_object_storage();
+
+	comparisons.push_back(adding);
+	comparisons.push_back(removing);
+
+	cout.precision(2);
+	cout << fixed;
+
+	for (const auto &comparison : comparisons)
+		print_comparison(comparison);
+
+	return write_report(comparisons);
+}
+
+micro_benchmark::comparison
+							micro_benchmark::measure_texture_lookups()
+{
+	const int				number_of_lookups = micro_benchmark_settings::number_of_texture_lookups;
+
+	// Reproduces previous access pattern of atlas, which checked map and then read it under two shared locks
+	map<block_type, ivec2>	locked_map;
+	shared_mutex			mutex;
+
+	for (int type = 0; type < texture_atlas::number_of_types; type++)
+		locked_map[(block_type)type] = ivec2(type);
+
+	const auto				lookup_locked = [&](block_type type)
+	{
+		{
+			shared_lock		lock(mutex);
+
+			if (locked_map.find(type) == locked_map.end())
+				return 0.f;
+		}
+
+		shared_lock			lock(mutex);
+
+		return (float)locked_map.at(type).x;
+	};
+
+	const auto				lookup_frozen = [](block_type type)
+	{
+		return texture_atlas::get_rectangle(type, block_face::top).min.x;
+	};
+
+	// Every thread does its share of lookups at same time, like geometry tasks do
+	const float				locked = measure_on_all_threads(number_of_lookups, [&](int index)
+	{
+		return lookup_locked((block_type)(index % texture_atlas::number_of_types));
+	});
+	const float				frozen = measure_on_all_threads(number_of_lookups, [&](int index)
+	{
+		return lookup_frozen((block_type)(index % texture_atlas::number_of_types));
+	});
+
+	return {"texture_lookups", "per_second", locked, frozen};
+}
+
+micro_benchmark::comparison
+							micro_benchmark::measure_singleton_access()
+{
+	const int				number_of_accesses = micro_benchmark_settings::number_of_singleton_accesses;
+
+	// Previous access path, every call copies shared pointer and touches its reference counter
+	const float				shared = measure_on_all_threads(number_of_accesses, [](int)
+	{
+		return (float)(singleton<texture_atlas>::get_shared_instance() != nullptr);
+	});
+	const float				raw = measure_on_all_threads(number_of_accesses, [](int)
+	{
+		return (float)(singleton<texture_atlas>::get_instance() != nullptr);
+	});
+
+	return {"singleton_accesses", "per_second", shared, raw};
+}
+
+micro_benchmark::comparison
+							micro_benchmark::measure_geometry()
+{
+	const auto				region = determinism_check::create_region();
+	pending_block_writes	pending_writes;
+
+	for (const auto &chunk : region)
+		determinism_check::generate_chunk(chunk, pending_writes);
+	for (const auto &chunk : region)
+		pending_writes.apply(*chunk);
+
+	// Chunks are only read, so every thread can build geometry of any of them
+	const auto				build_geometry = [&region](int index)
+	{
+		chunk_workspace		workspace(region[index % region.size()]);
+		chunk_geometry_generation_task	task;
+
+		task.execute(workspace);
+		return (float)workspace.batch_for_opaque.indices.size();
+	};
+
+	singleton_settings::should_copy_shared_pointer = true;
+	const float				shared = measure_on_all_threads(micro_benchmark_settings::number_of_geometry_builds, build_geometry);
+
+	singleton_settings::should_copy_shared_pointer = false;
+	const float				raw = measure_on_all_threads(micro_benchmark_settings::number_of_geometry_builds, build_geometry);
+
+	return {"geometry_builds", "per_second", shared, raw};
+}
+
+micro_benchmark::comparison
+							micro_benchmark::measure_notifications()
+{
+	const int				number_of_notifications = micro_benchmark_settings::number_of_notifications;
+	const int				number_of_listeners = micro_benchmark_settings::number_of_listeners;
+	const int				number_of_deliveries = number_of_notifications * number_of_listeners;
+
+	// Reproduces previous notifier, listeners were kept in hash map and classified events with dynamic_cast
+	struct					legacy_event
+	{
+		virtual				~legacy_event() = default;
+	};
+
+	struct					legacy_probe_event : public legacy_event
+	{
+		int					value = 1;
+	};
+
+	struct					legacy_other_event : public legacy_event {};
+
+	struct					legacy_listener
+	{
+		int					sum = 0;
+
+		virtual				~legacy_listener() = default;
+
+		virtual void		when_notified(const legacy_event &event)
+		{
+			if (dynamic_cast<const legacy_other_event *>(&event) != nullptr)
+				sum--;
+			else if (const auto *probe = dynamic_cast<const legacy_probe_event *>(&event))
+				sum += probe->value;
+		}
+	};
+
+	struct					probe_event
+	{
+		int					value = 1;
+	};
+
+	struct					other_event {};
+
+	struct					probe_listener : public listener<probe_event>, public listener<other_event>
+	{
+		int					sum = 0;
+
+		void				when_notified(const probe_event &event) override
+		{
+			sum += event.value;
+		}
+
+		void				when_notified(const other_event &) override
+		{
+			sum--;
+		}
+	};
+
+	struct					probe_notifier : public notifier<probe_event, other_event>
+	{
+		using				notifier::notify;
+	};
+
+	vector<legacy_listener>	legacy_listeners(number_of_listeners);
+	vector<probe_listener>	probe_listeners(number_of_listeners);
+
+	unordered_map<size_t, reference_wrapper<legacy_listener>>
+							legacy_notifier;
+	probe_notifier			notifier;
+
+	for (auto &listener : legacy_listeners)
+		legacy_notifier.emplace((size_t)&listener, ref(listener));
+	for (auto &listener : probe_listeners)
+		notifier.subscribe<probe_event>(listener);
+
+	const auto				legacy_start = clock::now();
+
+	for (int index = 0; index < number_of_notifications; index++)
+	{
+		const legacy_probe_event	event;
+
+		for (const auto &[pointer, listener] : legacy_notifier)
+			listener.get().when_notified(event);
+	}
+
+	const float				legacy_time = clock::get_seconds_since(legacy_start);
+	const auto				start = clock::now();
+
+	for (int index = 0; index < number_of_notifications; index++)
+		notifier.notify(probe_event());
+
+	const float				time = clock::get_seconds_since(start);
+	int						checksum = 0;
+
+	// Checksum is consumed, so compiler can't throw notifications away
+	for (int index = 0; index < number_of_listeners; index++)
+		checksum += legacy_listeners[index].sum - probe_listeners[index].sum;
+
+	if (checksum != 0)
+		debug::log("[game::micro_benchmark] Unexpected notification checksum");
+
+	const float				legacy = legacy_time > 0.f ? (float)number_of_deliveries / legacy_time : 0.f;
+	const float				current = time > 0.f ? (float)number_of_deliveries / time : 0.f;
+
+	return {"notification_deliveries", "per_second", legacy, current};
+}
+
+pair<micro_benchmark::comparison, micro_benchmark::comparison>
+							micro_benchmark::measure_object_storage()
+{
+	const int				number_of_objects = micro_benchmark_settings::number_of_objects;
+
+	struct					probe_object : public engine::object
+	{
+							probe_object()
+		{
+			set_layout("System");
+		}
+	};
+
+	vector<shared_ptr<object>>	objects;
+
+	for (int index = 0; index < number_of_objects; index++)
+		objects.push_back(make_shared<probe_object>());
+
+	// Reproduces previous storage, objects were kept in map by address and layouts were searched by name
+	using					legacy_layout = pair<string, vector<shared_ptr<object>>>;
+
+	map<intptr_t, shared_ptr<object>>	legacy_storage;
+	vector<legacy_layout>	legacy_layouts(layout_manager::get_layouts().size());
+	comparison				adding = {"object_adding", "ms"};
+	comparison				removing = {"object_removing", "ms"};
+
+	for (int index = 0; index < (int)legacy_layouts.size(); index++)
+		legacy_layouts[index].first = "Layout " + to_string(index);
+	legacy_layouts[layout_manager::get_handle("System")].first = "System";
+
+	// Layout of probe objects always exists, so search never falls through
+	const auto				find_legacy_layout = [&legacy_layouts](const shared_ptr<object> &object)
+	{
+		for (auto &layout : legacy_layouts)
+			if (layout.first == object->get_layout())
+				return &layout.second;
+		return &legacy_layouts.front().second;
+	};
+
+	auto					start = clock::now();
+
+	for (const auto &object : objects)
+	{
+		legacy_storage.emplace((intptr_t)object.get(), object);
+		find_legacy_layout(object)->push_back(object);
+	}
+
+	adding.legacy = clock::get_seconds_since(start) * 1000.f;
+	start = clock::now();
+
+	for (const auto &object : objects)
+	{
+		auto				*layout_objects = find_legacy_layout(object);
+
+		layout_objects->erase(find(layout_objects->begin(), layout_objects->end(), object));
+		legacy_storage.erase((intptr_t)object.get());
+	}
+
+	removing.legacy = clock::get_seconds_since(start) * 1000.f;
+
+	start = clock::now();
+
+	for (const auto &object : objects)
+		object_storage::add(object);
+
+	adding.current = clock::get_seconds_since(start) * 1000.f;
+	start = clock::now();
+
+	for (const auto &object : objects)
+		object_storage::remove(object);
+
+	removing.current = clock::get_seconds_since(start) * 1000.f;
+
+	return {adding, removing};
+}
+
+template					<typename type>
+float						micro_benchmark::measure_on_all_threads(int number_of_operations, const type &operation)
+{
+	const int				number_of_threads = std::max(1, (int)thread::hardware_concurrency());
+
+	vector<future<float>>	futures;
+	float					checksum = 0.f;
+	const auto				start = clock::now();
+
+	for (int thread_index = 0; thread_index < number_of_threads; thread_index++)
+	{
+		futures.push_back(async(launch::async, [&operation, number_of_operations, number_of_threads]()
+		{
+			float			sum = 0.f;
+
+			for (int index = 0; index < number_of_operations / number_of_threads; index++)
+				sum += operation(index);
+
+			return sum;
+		}));
+	}
+
+	for (auto &future : futures)
+		checksum += future.get();
+
+	const float				time = clock::get_seconds_since(start);
+
+	// Checksum is consumed, so compiler can't throw operations away
+	if (checksum < 0.f)
+		debug::log("[game::micro_benchmark] Unexpected checksum");
+
+	return time > 0.f ? (float)number_of_operations / time : 0.f;
+}
+
+void						micro_benchmark::print_comparison(const comparison &comparison)
+{
+	cout << comparison.name << " (" << comparison.unit << ") : ";
+	cout << comparison.legacy << " legacy, " << comparison.current << " current" << endl;
+}
+
+bool						micro_benchmark::write_report(const vector<comparison> &comparisons)
+{
+	ofstream				file(micro_benchmark_settings::report_path);
+
+	if (not debug::check(file.is_open(), "[game::micro_benchmark] Can't write report"))
+		return false;
+
+	file << "{\n";
+	file << "\t\"threads\" : " << thread::hardware_concurrency() << ",\n";
+	file << "\t\"comparisons\" :\n\t[\n";
+
+	for (int index = 0; index < (int)comparisons.size(); index++)
+	{
+		const auto			&comparison = comparisons[index];
+
+		file << "\t\t{ ";
+		file << "\"name\" : \"" << comparison.name << "\", ";
+		file << "\"unit\" : \"" << comparison.unit << "\", ";
+		file << "\"legacy\" : " << comparison.legacy << ", ";
+		file << "\"current\" : " << comparison.current;
+		file << (index + 1 < (int)comparisons.size() ? " },\n" : " }\n");
+	}
+
+	file << "\t]\n";
+	file << "}\n";
+
+	return true;
+}
\ No newline at end of file
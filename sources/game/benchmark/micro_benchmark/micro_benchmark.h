@@ -0,0 +1,48 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace							game
+{
+	class							micro_benchmark;
+}
+
+// Times reproductions of previous implementations of engine and game utilities against current ones.
+// Doesn't need world or streaming, so it runs right after setup and writes JSON report.
+class								game::micro_benchmark
+{
+public :
+
+	// Returns false if report can't be written
+	static bool						run();
+
+private :
+
+	// Same work, done by reproduction of previous implementation and by current one
+	struct							comparison
+	{
+		string						name;
+		string						unit;
+
+		float						legacy = 0.f;
+		float						current = 0.f;
+	};
+
+	static comparison				measure_texture_lookups();
+	static comparison				measure_singleton_access();
+
+	// Geometry stage with previous singleton access path and with current one
+	static comparison				measure_geometry();
+	static comparison				measure_notifications();
+
+	// Returns separate comparisons for adding and for removing
+	static pair<comparison, comparison>
+									measure_object_storage();
+
+	// Splits operations between all hardware threads and returns operations per second
+	template						<typename type>
+	static float					measure_on_all_threads(int number_of_operations, const type &operation);
+
+	static void						print_comparison(const comparison &comparison);
+	static bool						write_report(const vector<comparison> &comparisons);
+};
\ No newline at end of file
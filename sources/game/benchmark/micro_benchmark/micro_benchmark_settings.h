@@ -0,0 +1,28 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						micro_benchmark_settings;
+}
+
+struct							game::micro_benchmark_settings
+{
+	static inline bool			is_enabled = false;
+	static inline string		report_path = "micro_benchmark.json";
+
+	// Texture and singleton benchmarks split their operations between all hardware threads
+	static inline int			number_of_texture_lookups = 10000000;
+	static inline int			number_of_singleton_accesses = 10000000;
+
+	// Geometry of region from determinism check is built this many times in total, on all hardware threads
+	static inline int			number_of_geometry_builds = 1000;
+
+	// Each notification is sent to every listener
+	static inline int			number_of_notifications = 1000000;
+	static inline int			number_of_listeners = 8;
+
+	// Objects are added and then removed in the same order, previous storage is quadratic here
+	static inline int			number_of_objects = 100000;
+};
\ No newline at end of file
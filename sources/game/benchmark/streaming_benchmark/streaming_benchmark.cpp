@@ -0,0 +1,712 @@
+#include "streaming_benchmark.h"
+
+#include "application/common/debug/debug.h"
+#include "application/common/templates/singleton/singleton_settings.h"
+
+#include "engine/main/rendering/camera/camera/camera.h"
+#include "engine/main/system/window/window/window.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/memory_usage/memory_usage.h"
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
+#include "engine/main/rendering/null_gl/null_gl.h"
+
+#include "game/world/world/world.h"
+#include "game/world/world/world_settings.h"
+#include "game/player/player/player_settings.h"
+#include "game/player/ray_caster/ray_caster.h"
+#include "game/world/chunk/generation/chunk_generation_worker/chunk_generation_worker.h"
+#include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/utilities/noise/hash_noise.h"
+#include "game/world/chunk/chunk_renderer/chunk_renderer.h"
+#include "game/world/chunk/chunk/chunk_settings.h"
+#include "game/world/block/block/block.h"
+#include "game/benchmark/streaming_benchmark/streaming_benchmark_settings.h"
+
+using namespace				engine;
+using namespace				game;
+
+							streaming_benchmark::streaming_benchmark()
+{
+	set_layout("System");
+
+	path_index = -1;
+	frame = 0;
+	path_start = 0;
+	movement_end = 0;
+	created_chunks_at_start = 0;
+	destroyed_chunks_at_start = 0;
+	is_far_terrain_enabled_by_config = far_terrain_settings::is_enabled;
+	collision_queries_per_second = 0.f;
+	rays_per_second = {0.f, 0.f};
+	hashes_per_second = 0.f;
+	render_window_frame = 0;
+	sampling_step = 0;
+	surface_position = vec3(0.f);
+	backend_calls_at_last_update = 0;
+	backend_calls_of_last_frame = 0;
+	is_finished = false;
+}
+
+bool						streaming_benchmark::did_pass() const
+{
+	return is_finished and batched_frame.gl_calls < unbatched_frame.gl_calls;
+}
+
+void						streaming_benchmark::when_updated()
+{
+	const int				number_of_recorded_frames = profiler::get_number_of_recorded_frames();
+
+	if (is_finished)
+		return;
+	if (not world::is_ready())
+		return;
+
+	if (path_index == number_of_path_runs)
+	{
+		if (sample_frames())
+			finish();
+		return;
+	}
+
+	if (not path)
+	{
+		path_index++;
+
+		// Frame samples start on next frame, after last path is finished, they are taken with configured far terrain
+		if (path_index == number_of_path_runs)
+		{
+			far_terrain_settings::is_enabled = is_far_terrain_enabled_by_config;
+			return;
+		}
+
+		start_path();
+	}
+
+	if (number_of_recorded_frames > 0)
+		frame_times.push_back(profiler::get_frame_time(number_of_recorded_frames - 1));
+
+	if (frame < path->get_number_of_frames())
+	{
+		camera::set_position(path->get_position(frame++));
+
+		if (frame == path->get_number_of_frames())
+			movement_end = clock::now();
+		return;
+	}
+
+	if (is_world_loaded())
+		finish_path(true);
+	else if (clock::get_seconds_since(movement_end) > streaming_benchmark_settings::loading_timeout)
+		finish_path(false);
+}
+
+void						streaming_benchmark::finish()
+{
+	collision_queries_per_second = measure_collision_queries();
+	rays_per_second = measure_ray_casts();
+
+	for (const auto type : {noise_backend::type::native, noise_backend::type::fast_noise})
+		noise_results.push_back(measure_noise(type));
+
+	hashes_per_second = measure_hash();
+
+	is_finished = true;
+
+	if (not did_pass())
+	{
+		debug::raise_warning
+		(
+			"[game::streaming_benchmark] Batching didn't reduce GL calls : " +
+			to_string(unbatched_frame.gl_calls) + " unbatched, " + to_string(batched_frame.gl_calls) + " batched"
+		);
+	}
+
+	write_report();
+	window::close();
+}
+
+bool						streaming_benchmark::sample_frames()
+{
+	backend_calls_of_last_frame = null_gl::get_number_of_calls() - backend_calls_at_last_update;
+	backend_calls_at_last_update = null_gl::get_number_of_calls();
+
+	// State is changed during update and frame, that was rendered with it, is read during next update
+	switch (sampling_step)
+	{
+		case 0 :
+			chunk_renderer::set_batching(false);
+			break;
+
+		case 1 :
+			unbatched_frame = sample_frame();
+			chunk_renderer::set_batching(true);
+			break;
+
+		case 2 :
+			batched_frame = sample_frame();
+			break;
+
+		case 3 :
+			if (not sample_render_times(raw_access_render_times))
+				return false;
+			singleton_settings::should_copy_shared_pointer = true;
+			break;
+
+		case 4 :
+			if (not sample_render_times(shared_access_render_times))
+				return false;
+			singleton_settings::should_copy_shared_pointer = false;
+			surface_position = find_surface(camera::get_position());
+			camera::set_position(surface_position + vec3(0.f, streaming_benchmark_settings::above_ground_height, 0.f));
+			break;
+
+		case 5 :
+			above_ground_frame = sample_frame();
+			above_ground_occlusion = world::measure_occlusion(camera::get_position(), streaming_benchmark_settings::number_of_occlusion_repetitions);
+			camera::set_position(surface_position - vec3(0.f, streaming_benchmark_settings::below_ground_depth, 0.f));
+			break;
+
+		case 6 :
+			below_ground_frame = sample_frame();
+			below_ground_occlusion = world::measure_occlusion(camera::get_position(), streaming_benchmark_settings::number_of_occlusion_repetitions);
+			return true;
+
+		default :
+			return true;
+	}
+
+	sampling_step++;
+	return false;
+}
+
+streaming_benchmark::frame_sample
+							streaming_benchmark::sample_frame() const
+{
+	frame_sample			sample;
+
+	sample.gl_calls = gl_call_counter::get_total_calls();
+	sample.draw_calls = gl_call_counter::get_calls(gl_call_counter::type::draw);
+	sample.rendered_chunks = world::get_number_of_rendered_chunks();
+	sample.renderable_chunks = world::get_number_of_renderable_chunks();
+	sample.backend_calls = backend_calls_of_last_frame;
+
+	return sample;
+}
+
+bool						streaming_benchmark::sample_render_times(render_times &times)
+{
+	static const int		world_render_section = profiler::register_section("World render");
+	static const int		chunk_renderer_section = profiler::register_section("Chunk renderer");
+
+	const int				newest_frame = profiler::get_number_of_recorded_frames() - 1;
+	const int				number_of_frames = streaming_benchmark_settings::number_of_render_window_frames;
+
+	times.world_render += profiler::get_time(world_render_section, newest_frame);
+	times.chunk_renderer += profiler::get_time(chunk_renderer_section, newest_frame);
+
+	if (++render_window_frame < number_of_frames)
+		return false;
+
+	times.world_render /= (float)number_of_frames;
+	times.chunk_renderer /= (float)number_of_frames;
+	render_window_frame = 0;
+
+	return true;
+}
+
+// Highest block, that isn't air or cloud, so camera can be placed above or below terrain
+vec3						streaming_benchmark::find_surface(const vec3 &position)
+{
+	for (int y = chunk_settings::size[1] - 1; y >= 0; y--)
+	{
+		const auto			block = world::find_block(vec3(position.x, (float)y, position.z));
+
+		if (block == nullptr)
+			continue ;
+		if (block->get_type() == block_type::air or block->get_type() == block_type::cloud)
+			continue ;
+
+		return vec3(position.x, (float)y + 1.f, position.z);
+	}
+
+	return vec3(position.x, (float)chunk_settings::zero_height, position.z);
+}
+
+void						streaming_benchmark::start_path()
+{
+	// Far terrain keeps its chunks while it's disabled, they are just neither updated nor rendered
+	far_terrain_settings::is_enabled = path_index < number_of_paths and is_far_terrain_enabled_by_config;
+
+	path = camera_path(paths[path_index % number_of_paths], camera::get_position());
+	frame = 0;
+
+	path_start = clock::now();
+	movement_end = path_start;
+
+	created_chunks_at_start = world::get_number_of_created_chunks();
+	destroyed_chunks_at_start = world::get_number_of_destroyed_chunks();
+	far_terrain_at_start = take_far_terrain_snapshot();
+	frame_times.clear();
+}
+
+void						streaming_benchmark::finish_path(bool did_load)
+{
+	result					result;
+
+	const auto				get_percentile = [this](float percentile)
+	{
+		const int			index = (int)(percentile * (float)frame_times.size());
+
+		return frame_times[min(index, (int)frame_times.size() - 1)] * 1000.f;
+	};
+
+	sort(frame_times.begin(), frame_times.end());
+
+	result.name = path->get_name();
+	result.number_of_frames = (int)frame_times.size();
+
+	result.number_of_created_chunks = world::get_number_of_created_chunks() - created_chunks_at_start;
+	result.number_of_destroyed_chunks = world::get_number_of_destroyed_chunks() - destroyed_chunks_at_start;
+
+	result.did_load = did_load;
+	result.loading_time = clock::get_seconds_since(path_start);
+	result.settling_time = clock::get_seconds_since(movement_end);
+
+	if (not frame_times.empty())
+	{
+		result.frame_time_50 = get_percentile(0.5f);
+		result.frame_time_90 = get_percentile(0.9f);
+		result.frame_time_99 = get_percentile(0.99f);
+		result.frame_time_max = frame_times.back() * 1000.f;
+	}
+
+	result.peak_memory = memory_usage::get_peak();
+
+	const auto				far_terrain_at_end = take_far_terrain_snapshot();
+	clock::ticks			far_terrain_cpu_time = far_terrain_at_end.update_time - far_terrain_at_start.update_time;
+
+	result.is_far_terrain_enabled = far_terrain_settings::is_enabled;
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+	{
+		const auto			time = far_terrain_at_end.generation_times[level] - far_terrain_at_start.generation_times[level];
+		const int			number = far_terrain_at_end.numbers_of_generations[level] - far_terrain_at_start.numbers_of_generations[level];
+
+		if (number > 0)
+			result.far_chunk_times[level] = clock::to_seconds(time) / (float)number * 1000.f;
+		result.numbers_of_far_chunks[level] = number;
+
+		far_terrain_cpu_time += time;
+	}
+
+	result.far_terrain_cpu_time = clock::to_seconds(far_terrain_cpu_time) * 1000.f;
+
+	debug::log("[game::streaming_benchmark] Path '" + result.name + "' is finished");
+
+	results.push_back(result);
+	path = nullopt;
+}
+
+bool						streaming_benchmark::is_world_loaded() const
+{
+	const float				radius = world_settings::visibility_limit[world_settings::current_visibility_option];
+	const auto				[number_of_loaded_chunks, number_of_chunks] = world::get_loading_progress(radius);
+
+	return number_of_loaded_chunks == number_of_chunks;
+}
+
+streaming_benchmark::far_terrain_snapshot
+							streaming_benchmark::take_far_terrain_snapshot()
+{
+	far_terrain_snapshot	snapshot;
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+	{
+		snapshot.generation_times[level] = far_terrain::get_generation_time(level);
+		snapshot.numbers_of_generations[level] = far_terrain::get_number_of_generations(level);
+	}
+
+	snapshot.update_time = far_terrain::get_update_time();
+	return snapshot;
+}
+
+float						streaming_benchmark::measure_collision_queries()
+{
+	static const float		golden_angle = 2.39996323f;
+	static const float		query_distance = 0.5f;
+
+	const int				number_of_queries = streaming_benchmark_settings::number_of_collision_queries;
+	const vec3				center = camera::get_position();
+	const vec3				half_size = player_settings::aabb_size / 2.f;
+
+	int						number_of_contacts = 0;
+	const auto				start = clock::now();
+
+	for (int query = 0; query < number_of_queries; query++)
+	{
+		const float			angle = golden_angle * (float)query;
+		const vec3			offset = vec3(cos(angle), sin(angle * 0.5f), sin(angle)) * query_distance;
+
+		if (world::sweep(aabb(center - half_size, center + half_size), offset))
+			number_of_contacts++;
+	}
+
+	const float				time = clock::get_seconds_since(start);
+
+	debug::log
+	(
+		"[game::streaming_benchmark] Collision queries : " + to_string(number_of_queries) +
+		", contacts : " + to_string(number_of_contacts)
+	);
+
+	return time > 0.f ? (float)number_of_queries / time : 0.f;
+}
+
+pair<float, float>			streaming_benchmark::measure_ray_casts()
+{
+	static const float		golden_angle = 2.39996323f;
+
+	const int				number_of_rays = streaming_benchmark_settings::number_of_rays;
+	const vec3				origin = camera::get_position();
+
+	vector<ray_caster::ray>	rays;
+
+	// Directions are spread evenly over sphere
+	for (int index = 0; index < number_of_rays; index++)
+	{
+		const float			y = 1.f - 2.f * ((float)index + 0.5f) / (float)number_of_rays;
+		const float			radius = sqrt(1.f - y * y);
+		const float			angle = golden_angle * (float)index;
+
+		rays.push_back({origin, vec3(cos(angle) * radius, y, sin(angle) * radius), streaming_benchmark_settings::ray_distance});
+	}
+
+	const auto				get_rays_per_second = [number_of_rays](float time)
+	{
+		return time > 0.f ? (float)number_of_rays / time : 0.f;
+	};
+
+	int						number_of_hits = 0;
+	auto					start = clock::now();
+
+	for (const auto &ray : rays)
+	{
+		if (ray_caster::cast_ray(ray))
+			number_of_hits++;
+	}
+
+	const float				single_time = clock::get_seconds_since(start);
+
+	start = clock::now();
+	ray_caster::cast_rays(rays);
+
+	const float				batched_time = clock::get_seconds_since(start);
+
+	debug::log
+	(
+		"[game::streaming_benchmark] Rays : " + to_string(number_of_rays) +
+		", hits : " + to_string(number_of_hits)
+	);
+
+	return {get_rays_per_second(single_time), get_rays_per_second(batched_time)};
+}
+
+streaming_benchmark::noise_result
+							streaming_benchmark::measure_noise(noise_backend::type type)
+{
+	static const ivec3		grid_size = ivec3(chunk_settings::size[0], chunk_settings::size[1], chunk_settings::size[2]);
+
+	const noise_backend		&backend = noise_backend::get(type);
+	const int				seed = biome_generator::get_config().seed;
+	const int				number_of_samples = streaming_benchmark_settings::number_of_noise_samples;
+
+	const auto				gradient_2d = backend.create_gradient_2d(seed, 0.01f);
+	const auto				gradient_3d = backend.create_gradient_3d(seed, 0.02f);
+	const auto				cellular_2d = backend.create_cellular_2d(seed, 0.0018f);
+
+	noise_result			result;
+
+	// Sum of samples is logged, so compiler can't throw sampling away
+	float					checksum = 0.f;
+
+	const auto				get_samples_per_second = [](int number_of_samples, float time)
+	{
+		return time > 0.f ? (float)number_of_samples / time : 0.f;
+	};
+
+	const auto				measure = [&](const auto &sample)
+	{
+		const auto			start = clock::now();
+
+		for (int index = 0; index < number_of_samples; index++)
+			checksum += sample(index % 1000, index / 1000);
+
+		return get_samples_per_second(number_of_samples, clock::get_seconds_since(start));
+	};
+
+	result.backend = noise_backend::get_name(type);
+
+	result.gradient_2d = measure([&](int x, int y) { return (*gradient_2d)(vec2(x, y)); });
+	result.gradient_3d = measure([&](int x, int y) { return (*gradient_3d)(vec3(x, y % 256, y)); });
+	result.cellular_2d = measure([&](int x, int y) { return (*cellular_2d)(vec2(x, y)); });
+
+	const int				number_of_grid_samples = grid_size.x * grid_size.y * grid_size.z;
+	vector<float>			grid(number_of_grid_samples);
+	const auto				start = clock::now();
+
+	gradient_3d->generate_grid(vec3(0.f), grid_size, grid.data());
+	result.gradient_3d_grid = get_samples_per_second(number_of_grid_samples, clock::get_seconds_since(start));
+
+	for (const auto value : grid)
+		checksum += value;
+
+	debug::log("[game::streaming_benchmark] Noise '" + result.backend + "' checksum : " + to_string(checksum));
+
+	return result;
+}
+
+float						streaming_benchmark::measure_hash()
+{
+	const int				number_of_samples = streaming_benchmark_settings::number_of_noise_samples;
+	const hash_noise		random(biome_generator::get_config().seed);
+
+	uint32_t				checksum = 0;
+	const auto				start = clock::now();
+
+	for (int index = 0; index < number_of_samples; index++)
+		checksum ^= random.hash(ivec3(index % 100, index / 10000, index / 100 % 100));
+
+	const float				time = clock::get_seconds_since(start);
+
+	// Hash is platform independent, so checksum should be same on every machine
+	debug::log("[game::streaming_benchmark] Hash checksum : " + to_string(checksum));
+
+	return time > 0.f ? (float)number_of_samples / time : 0.f;
+}
+
+void						streaming_benchmark::write_report() const
+{
+	ofstream				file(streaming_benchmark_settings::report_path);
+
+	if (not debug::check(file.is_open(), "[game::streaming_benchmark] Can't write report"))
+		return;
+
+	file << "{\n";
+	file << "\t\"seed\" : " << biome_generator::get_config().seed << ",\n";
+	file << "\t\"paths\" :\n\t[\n";
+
+	for (int index = 0; index < (int)results.size(); index++)
+	{
+		write_result(file, results[index]);
+		file << (index + 1 < (int)results.size() ? ",\n" : "\n");
+	}
+
+	file << "\t],\n";
+	write_far_terrain(file);
+	file << "\t\"collision_queries_per_second\" : " << collision_queries_per_second << ",\n";
+	file << "\t\"rays_per_second\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"single\" : " << rays_per_second.first << ",\n";
+	file << "\t\t\"batched\" : " << rays_per_second.second << "\n";
+	file << "\t},\n";
+	file << "\t\"noise\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"selected_backend\" : \"" << noise_backend::get_name(biome_generator::get_config().noise_type) << "\",\n";
+	file << "\t\t\"hashes_per_second\" : " << hashes_per_second << ",\n";
+	file << "\t\t\"samples_per_second\" :\n";
+	file << "\t\t[\n";
+
+	for (int index = 0; index < (int)noise_results.size(); index++)
+	{
+		write_noise_result(file, noise_results[index]);
+		file << (index + 1 < (int)noise_results.size() ? ",\n" : "\n");
+	}
+
+	file << "\t\t],\n";
+	write_task_times(file);
+	file << "\t},\n";
+
+	file << "\t\"gl_calls\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"unbatched\" : ";
+	write_frame_sample(file, unbatched_frame);
+	file << ",\n";
+	file << "\t\t\"batched\" : ";
+	write_frame_sample(file, batched_frame);
+	file << ",\n";
+	file << "\t\t\"did_reduce\" : " << (did_pass() ? "true" : "false") << "\n";
+	file << "\t},\n";
+	file << "\t\"occlusion\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"above_ground\" :\n";
+	write_occlusion_sample(file, above_ground_frame, above_ground_occlusion);
+	file << ",\n";
+	file << "\t\t\"below_ground\" :\n";
+	write_occlusion_sample(file, below_ground_frame, below_ground_occlusion);
+	file << "\n";
+	file << "\t},\n";
+	file << "\t\"warm_up_time_s\" : " << world::get_warm_up_time() << ",\n";
+	file << "\t\"render_loop\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"raw_singleton_access\" : ";
+	write_render_times(file, raw_access_render_times);
+	file << ",\n";
+	file << "\t\t\"shared_singleton_access\" : ";
+	write_render_times(file, shared_access_render_times);
+	file << "\n";
+	file << "\t},\n";
+
+	// Time from creation of chunk to its first model, includes waiting for neighbors
+	file << "\t\"time_to_first_model_ms\" : " << chunk_generation_worker::get_average_time_to_first_model() * 1000.f << ",\n";
+	file << "\t\"pending_block_writes\" : " << chunk_generation_director::get_pending_writes().get_number_of_writes() << "\n";
+	file << "}\n";
+}
+
+void						streaming_benchmark::write_result(ofstream &file, const result &result)
+{
+	file << "\t\t{\n";
+	file << "\t\t\t\"name\" : \"" << result.name << "\",\n";
+	file << "\t\t\t\"frames\" : " << result.number_of_frames << ",\n";
+	file << "\t\t\t\"chunks_created\" : " << result.number_of_created_chunks << ",\n";
+	file << "\t\t\t\"chunks_destroyed\" : " << result.number_of_destroyed_chunks << ",\n";
+	file << "\t\t\t\"did_load\" : " << (result.did_load ? "true" : "false") << ",\n";
+	file << "\t\t\t\"loading_time_s\" : " << result.loading_time << ",\n";
+	file << "\t\t\t\"settling_time_s\" : " << result.settling_time << ",\n";
+	file << "\t\t\t\"frame_time_ms\" :\n";
+	file << "\t\t\t{\n";
+	file << "\t\t\t\t\"p50\" : " << result.frame_time_50 << ",\n";
+	file << "\t\t\t\t\"p90\" : " << result.frame_time_90 << ",\n";
+	file << "\t\t\t\t\"p99\" : " << result.frame_time_99 << ",\n";
+	file << "\t\t\t\t\"max\" : " << result.frame_time_max << "\n";
+	file << "\t\t\t},\n";
+	file << "\t\t\t\"peak_memory_mb\" : " << result.peak_memory << ",\n";
+	file << "\t\t\t\"far_terrain\" :\n";
+	file << "\t\t\t{\n";
+	file << "\t\t\t\t\"is_enabled\" : " << (result.is_far_terrain_enabled ? "true" : "false") << ",\n";
+	file << "\t\t\t\t\"lod_ms\" : [";
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+		file << (level == 0 ? " " : ", ") << result.far_chunk_times[level];
+
+	file << " ],\n";
+	file << "\t\t\t\t\"lod_chunks\" : [";
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+		file << (level == 0 ? " " : ", ") << result.numbers_of_far_chunks[level];
+
+	file << " ],\n";
+	file << "\t\t\t\t\"cpu_ms\" : " << result.far_terrain_cpu_time << "\n";
+	file << "\t\t\t}\n";
+	file << "\t\t}";
+}
+
+// Far terrain cost of whole run, split by passes with far terrain and without it
+void						streaming_benchmark::write_far_terrain(ofstream &file) const
+{
+	float					cpu_time_when_enabled = 0.f;
+	float					cpu_time_when_disabled = 0.f;
+
+	for (const auto &result : results)
+	{
+		if (result.is_far_terrain_enabled)
+			cpu_time_when_enabled += result.far_terrain_cpu_time;
+		else
+			cpu_time_when_disabled += result.far_terrain_cpu_time;
+	}
+
+	file << "\t\"far_terrain\" :\n";
+	file << "\t{\n";
+	file << "\t\t\"lod_ms\" : [";
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+		file << (level == 0 ? " " : ", ") << far_terrain::get_average_generation_time(level);
+
+	file << " ],\n";
+	file << "\t\t\"cpu_ms\" :\n";
+	file << "\t\t{\n";
+	file << "\t\t\t\"enabled\" : " << cpu_time_when_enabled << ",\n";
+	file << "\t\t\t\"disabled\" : " << cpu_time_when_disabled << "\n";
+	file << "\t\t}\n";
+	file << "\t},\n";
+}
+
+void						streaming_benchmark::write_frame_sample(ofstream &file, const frame_sample &sample)
+{
+	file << "{ ";
+	file << "\"gl_calls\" : " << sample.gl_calls << ", ";
+	file << "\"draw_calls\" : " << sample.draw_calls << ", ";
+	file << "\"rendered_chunks\" : " << sample.rendered_chunks << ", ";
+	file << "\"renderable_chunks\" : " << sample.renderable_chunks << ", ";
+	file << "\"backend_calls\" : " << sample.backend_calls;
+	file << " }";
+}
+
+void						streaming_benchmark::write_render_times(ofstream &file, const render_times &times)
+{
+	file << "{ ";
+	file << "\"world_render_ms\" : " << times.world_render * 1000.f << ", ";
+	file << "\"chunk_renderer_ms\" : " << times.chunk_renderer * 1000.f;
+	file << " }";
+}
+
+void						streaming_benchmark::write_occlusion_sample
+							(
+								ofstream &file,
+								const frame_sample &frame,
+								const world::occlusion_sample &occlusion
+							)
+{
+	file << "\t\t{\n";
+	file << "\t\t\t\"frame\" : ";
+	write_frame_sample(file, frame);
+	file << ",\n";
+	file << "\t\t\t\"visible_chunks\" : " << occlusion.visible_chunks << ",\n";
+	file << "\t\t\t\"renderable_chunks\" : " << occlusion.renderable_chunks << ",\n";
+	file << "\t\t\t\"visited_sections\" : " << occlusion.visited_sections << ",\n";
+	file << "\t\t\t\"traversal_ms\" : " << occlusion.time * 1000.f << "\n";
+	file << "\t\t}";
+}
+
+void						streaming_benchmark::write_noise_result(ofstream &file, const noise_result &result)
+{
+	file << "\t\t\t{\n";
+	file << "\t\t\t\t\"backend\" : \"" << result.backend << "\",\n";
+	file << "\t\t\t\t\"gradient_2d\" : " << result.gradient_2d << ",\n";
+	file << "\t\t\t\t\"gradient_3d\" : " << result.gradient_3d << ",\n";
+	file << "\t\t\t\t\"gradient_3d_grid\" : " << result.gradient_3d_grid << ",\n";
+	file << "\t\t\t\t\"cellular_2d\" : " << result.cellular_2d << "\n";
+	file << "\t\t\t}";
+}
+
+// Average time of each generation stage with selected backend, so two runs with different backends can be compared
+void						streaming_benchmark::write_task_times(ofstream &file)
+{
+	using					status = chunk_generation_worker::generation_status;
+
+	static const pair<string, status>	stages[] =
+	{
+		{"surface", status::generated_surface},
+		{"landscape", status::generated_landscape},
+		{"decorations", status::generated_decorations},
+		{"light", status::generated_light},
+		{"geometry", status::generated_geometry},
+		{"model", status::generated_model}
+	};
+
+	float					total_time = 0.f;
+
+	file << "\t\t\"task_time_ms\" :\n";
+	file << "\t\t{\n";
+
+	for (const auto &[name, stage] : stages)
+	{
+		const float			time = chunk_generation_worker::get_average_task_time(stage) * 1000.f;
+
+		file << "\t\t\t\"" << name << "\" : " << time << ",\n";
+		total_time += time;
+	}
+
+	file << "\t\t\t\"total\" : " << total_time << "\n";
+	file << "\t\t}\n";
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "engine/main/core/object/object/object.h"
+#include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/benchmark/camera_path/camera_path.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+#include "game/world/world/world.h"
+
+namespace								game
+{
+	class								streaming_benchmark;
+}
+
+// Flies camera through fixed sequence of paths, measures world streaming and writes JSON report.
+// Sequence is flown twice, first with far terrain as configured and then without it, so its cost can be compared.
+// Each path starts where previous one ended, so whole run is deterministic.
+class									game::streaming_benchmark :
+											public engine::object,
+											public engine::unique_object_constructor<game::streaming_benchmark>
+{
+public :
+										streaming_benchmark();
+										~streaming_benchmark() override = default;
+
+	// False until benchmark is finished, also false if batching didn't reduce GL calls
+	bool								did_pass() const;
+
+private :
+
+	struct								result
+	{
+		string							name;
+		int								number_of_frames = 0;
+
+		int								number_of_created_chunks = 0;
+		int								number_of_destroyed_chunks = 0;
+
+		bool							did_load = false;
+		float							loading_time = 0.f;
+		float							settling_time = 0.f;
+
+		float							frame_time_50 = 0.f;
+		float							frame_time_90 = 0.f;
+		float							frame_time_99 = 0.f;
+		float							frame_time_max = 0.f;
+
+		float							peak_memory = 0.f;
+
+		bool							is_far_terrain_enabled = false;
+
+		// Average time of single far chunk and number of generated far chunks of each level
+		array<float, far_terrain_settings::number_of_levels>
+										far_chunk_times = {};
+		array<int, far_terrain_settings::number_of_levels>
+										numbers_of_far_chunks = {};
+
+		// Generation of all levels on own threads and update on main thread, generation isn't limited by budget
+		float							far_terrain_cpu_time = 0.f;
+	};
+
+	struct								far_terrain_snapshot
+	{
+		array<engine::clock::ticks, far_terrain_settings::number_of_levels>
+										generation_times = {};
+		array<int, far_terrain_settings::number_of_levels>
+										numbers_of_generations = {};
+		engine::clock::ticks			update_time = 0;
+	};
+
+	struct								noise_result
+	{
+		string							backend;
+
+		float							gradient_2d = 0.f;
+		float							gradient_3d = 0.f;
+		float							gradient_3d_grid = 0.f;
+		float							cellular_2d = 0.f;
+	};
+
+	// GL calls and chunks of single rendered frame
+	struct								frame_sample
+	{
+		int								gl_calls = 0;
+		int								draw_calls = 0;
+		int								rendered_chunks = 0;
+		int								renderable_chunks = 0;
+
+		// Calls, that reached null GL backend between two updates, so uploads of that update are included.
+		// Zero when real GL is used.
+		int64_t							backend_calls = 0;
+	};
+
+	static constexpr camera_path::type	paths[] =
+	{
+		camera_path::type::still,
+		camera_path::type::sprint,
+		camera_path::type::spiral,
+		camera_path::type::teleport
+	};
+
+	static constexpr int				number_of_paths = 4;
+	static constexpr int				number_of_passes = 2;
+	static constexpr int				number_of_path_runs = number_of_paths * number_of_passes;
+
+	int									path_index;
+	optional<camera_path>				path;
+	int									frame;
+
+	engine::clock::ticks				path_start;
+	engine::clock::ticks				movement_end;
+
+	int									created_chunks_at_start;
+	int									destroyed_chunks_at_start;
+	far_terrain_snapshot				far_terrain_at_start;
+	vector<float>						frame_times;
+
+	bool								is_far_terrain_enabled_by_config;
+
+	vector<result>						results;
+	float								collision_queries_per_second;
+	pair<float, float>					rays_per_second;
+	vector<noise_result>				noise_results;
+	float								hashes_per_second;
+
+	// Average times of render loop over fixed window of batched frames
+	struct								render_times
+	{
+		float							world_render = 0.f;
+		float							chunk_renderer = 0.f;
+	};
+
+	render_times						raw_access_render_times;
+	render_times						shared_access_render_times;
+	int									render_window_frame;
+
+	int									sampling_step;
+	frame_sample						unbatched_frame;
+	frame_sample						batched_frame;
+
+	vec3								surface_position;
+	frame_sample						above_ground_frame;
+	frame_sample						below_ground_frame;
+	world::occlusion_sample				above_ground_occlusion;
+	world::occlusion_sample				below_ground_occlusion;
+
+	int64_t								backend_calls_at_last_update;
+	int64_t								backend_calls_of_last_frame;
+
+	bool								is_finished;
+
+	void								when_updated() override;
+
+	void								start_path();
+	void								finish_path(bool did_load);
+
+	bool								is_world_loaded() const;
+
+	static far_terrain_snapshot			take_far_terrain_snapshot();
+
+	void								finish();
+
+	// Returns true, when all frame samples are taken
+	bool								sample_frames();
+	frame_sample						sample_frame() const;
+
+	// Adds times of the newest frame, returns true and averages them, when window is complete
+	bool								sample_render_times(render_times &times);
+	static vec3							find_surface(const vec3 &position);
+
+	static float						measure_collision_queries();
+
+	// Returns rays per second for single and batched casting
+	static pair<float, float>			measure_ray_casts();
+
+	// Returns samples per second for given backend
+	static noise_result					measure_noise(noise_backend::type type);
+	static float						measure_hash();
+
+	void								write_report() const;
+	static void							write_result(ofstream &file, const result &result);
+	void								write_far_terrain(ofstream &file) const;
+	static void							write_frame_sample(ofstream &file, const frame_sample &sample);
+	static void							write_render_times(ofstream &file, const render_times &times);
+	static void							write_occlusion_sample
+										(
+											ofstream &file,
+											const frame_sample &frame,
+											const world::occlusion_sample &occlusion
+										);
+	static void							write_noise_result(ofstream &file, const noise_result &result);
+	static void							write_task_times(ofstream &file);
+};
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						streaming_benchmark_settings;
+}
+
+struct							game::streaming_benchmark_settings
+{
+	static inline bool			is_enabled = false;
+	static inline string		report_path = "benchmark.json";
+
+	// Path is considered failed if world doesn't load completely after this time
+	static inline float			loading_timeout = 60.f;
+
+	// Collision micro-benchmark runs after last path, around final camera position
+	static inline int			number_of_collision_queries = 100000;
+
+	// Ray micro-benchmark casts same rays one by one and then as single batch
+	static inline int			number_of_rays = 100000;
+	static inline float			ray_distance = 64.f;
+
+	// Noise micro-benchmark samples each backend, not only selected one
+	static inline int			number_of_noise_samples = 1000000;
+
+	// Render loop is averaged over this many batched frames, first with raw singleton access and then with shared one
+	static inline int			number_of_render_window_frames = 60;
+
+	// Occlusion is sampled at final position above terrain and below it, traversal is repeated to average its time
+	static inline float			above_ground_height = 16.f;
+	static inline float			below_ground_depth = 32.f;
+	static inline int			number_of_occlusion_repetitions = 100;
+};
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "stress_test.h"
+
+#include "application/common/debug/debug.h"
+
+#include "engine/main/rendering/camera/camera/camera.h"
+#include "engine/main/system/window/window/window.h"
+
+#include "game/world/world/world.h"
+#include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
+#include "game/benchmark/stress_test/stress_test_settings.h"
+
+using namespace		engine;
+using namespace		game;
+
+					stress_test::stress_test()
+{
+	set_layout("System");
+
+	number_of_jumps = 0;
+	frame = 0;
+	settling_start = 0;
+	is_passed = false;
+}
+
+int					stress_test::get_number_of_jumps() const
+{
+	return number_of_jumps;
+}
+
+bool				stress_test::did_pass() const
+{
+	return is_passed;
+}
+
+void				stress_test::when_updated()
+{
+	// Jumps shouldn't overlap warm-up of spawn area
+	if (not world::is_ready())
+		return;
+
+	if (number_of_jumps < stress_test_settings::number_of_jumps)
+		jump();
+	else
+		settle();
+}
+
+void				stress_test::jump()
+{
+	if (++frame < stress_test_settings::frames_per_jump)
+		return;
+
+	const float		distance = stress_test_settings::jump_distance;
+
+	frame = 0;
+	number_of_jumps++;
+
+	// Points go in a zigzag, so every jump lands far from all previous points
+	camera::set_position(camera::get_position() + vec3(distance, 0.f, number_of_jumps % 2 == 0 ? -distance : distance));
+
+	if (number_of_jumps == stress_test_settings::number_of_jumps)
+		settling_start = clock::now();
+}
+
+void				stress_test::settle()
+{
+	if (is_settled())
+	{
+		is_passed = true;
+		window::close();
+	}
+	else if (clock::get_seconds_since(settling_start) > stress_test_settings::settling_timeout)
+	{
+		debug::raise_warning
+		(
+			"[game::stress_test] Generation didn't settle : " +
+			to_string(chunk_generation_director::get_number_of_dropped_workers()) + " dropped workers, " +
+			to_string(world::get_number_of_created_chunks() - world::get_number_of_destroyed_chunks()) + " chunks expected, " +
+			to_string(world::get_number_of_chunks()) + " chunks alive"
+		);
+		window::close();
+	}
+}
+
+bool				stress_test::is_settled()
+{
+	const int		number_of_expected_chunks = world::get_number_of_created_chunks() - world::get_number_of_destroyed_chunks();
+
+	if (chunk_generation_director::get_number_of_dropped_workers() > 0)
+		return false;
+	if (chunk_generation_director::has_completed_tasks())
+		return false;
+
+	return world::get_number_of_chunks() == number_of_expected_chunks;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "engine/main/core/object/object/object.h"
+#include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
+#include "engine/main/system/time/clock/clock.h"
+
+namespace			game
+{
+	class			stress_test;
+}
+
+// Teleports camera far away every few frames, so thousands of chunks are created and dropped mid-generation.
+// Then waits until generation settles and checks, that nothing is left behind.
+// Runs headless and is meant to be built with ThreadSanitizer, see FT_VOX_THREAD_SANITIZER.
+class				game::stress_test :
+						public engine::object,
+						public engine::unique_object_constructor<game::stress_test>
+{
+public :
+					stress_test();
+					~stress_test() override = default;
+
+	int				get_number_of_jumps() const;
+
+	// False until test is finished
+	bool			did_pass() const;
+
+private :
+
+	int				number_of_jumps;
+	int				frame;
+
+	engine::clock::ticks
+					settling_start;
+	bool			is_passed;
+
+	void			when_updated() override;
+
+	void			jump();
+	void			settle();
+
+	static bool		is_settled();
+};
\ No newline at end of file
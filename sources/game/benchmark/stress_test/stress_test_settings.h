@@ -0,0 +1,21 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						stress_test_settings;
+}
+
+struct							game::stress_test_settings
+{
+	static inline bool			is_enabled = false;
+
+	// Camera jumps before chunks around it are generated, so most of them are dropped while their tasks still run
+	static inline int			number_of_jumps = 500;
+	static inline int			frames_per_jump = 3;
+	static inline float			jump_distance = 1000.f;
+
+	// After last jump camera stays still, dropped workers and completed tasks should be drained within this time
+	static inline float			settling_timeout = 60.f;
+};
\ No newline at end of file
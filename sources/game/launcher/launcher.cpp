@@ -1,6 +1,12 @@
 #include "launcher.h"
 
+#include "application/common/debug/debug.h"
+
+#include "engine/launcher/launcher.h"
 #include "engine/main/rendering/layout/layout_manager/layout_manager.h"
+#include "engine/main/system/window/window/window.h"
+#include "engine/main/system/window/window/window_settings.h"
+#include "engine/main/processor/processor.h"
 #include "engine/extensions/utilities/fps_counter/fps_counter.h"
 #include "engine/extensions/ui/font/font_library/font_library.h"
 #include "engine/extensions/ui/font/symbol/symbol_renderer.h"
@@ -13,18 +19,90 @@
 #include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
 #include "game/world/chunk/chunk_renderer/chunk_renderer.h"
 #include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/plain/plain.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/forest/forest.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/desert/desert.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/mountains/mountains.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/lakes/lakes.h"
 #include "game/player/player/player.h"
+#include "game/player/scripted_camera/scripted_camera.h"
+#include "game/benchmark/streaming_benchmark/streaming_benchmark.h"
+#include "game/benchmark/streaming_benchmark/streaming_benchmark_settings.h"
+#include "game/benchmark/determinism_check/determinism_check_settings.h"
+#include "game/benchmark/micro_benchmark/micro_benchmark_settings.h"
+#include "game/benchmark/stress_test/stress_test.h"
+#include "game/benchmark/stress_test/stress_test_settings.h"
+#include "game/pregenerator/world_pregenerator/world_pregenerator_settings.h"
+#include "game/world/chunk/chunk_storage/chunk_storage.h"
+#include "game/world/chunk/chunk_storage/chunk_storage_settings.h"
 #include "game/ui/info/info.h"
 
 #include "engine/extensions/ui/font/font/font.h"
 
 using namespace 	game;
 
+void				launcher::parse_arguments(const vector<string> &arguments)
+{
+	for (int index = 0; index < (int)arguments.size(); index++)
+	{
+		const auto	&argument = arguments[index];
+
+		if (argument == "--benchmark")
+			streaming_benchmark_settings::is_enabled = true;
+		else if (argument == "--micro-benchmark")
+		{
+			// Micro-benchmark doesn't render anything, so it never needs real window or GL context
+			engine::window_settings::is_headless = true;
+			micro_benchmark_settings::is_enabled = true;
+		}
+		else if (argument == "--report" and index + 1 < (int)arguments.size())
+		{
+			streaming_benchmark_settings::report_path = arguments[++index];
+			micro_benchmark_settings::report_path = arguments[index];
+		}
+		else if (argument == "--noise" and index + 1 < (int)arguments.size())
+		{
+			if (auto type = noise_backend::find_type(arguments[++index]); type)
+				config.noise_type = *type;
+			else
+				debug::raise_warning("[game::launcher] Unknown noise backend '" + arguments[index] + "'");
+		}
+		else if (argument == "--seed" and index + 1 < (int)arguments.size())
+		{
+			if (const auto seed = engine::launcher::parse_number(arguments[++index]); seed)
+				config.seed = *seed;
+		}
+		else if (argument == "--stress")
+		{
+			engine::window_settings::is_headless = true;
+			stress_test_settings::is_enabled = true;
+		}
+		else if (argument == "--determinism-check")
+			determinism_check_settings::is_enabled = true;
+		else if (argument == "--world" and index + 1 < (int)arguments.size())
+			chunk_storage_settings::path = arguments[++index];
+		else if (argument == "--pregenerate" and index + 3 < (int)arguments.size())
+		{
+			const auto	center_x = engine::launcher::parse_number(arguments[++index]);
+			const auto	center_z = engine::launcher::parse_number(arguments[++index]);
+			const auto	radius = engine::launcher::parse_number(arguments[++index]);
+
+			if (not center_x or not center_z or not radius)
+				continue ;
+
+			// Pre-generation doesn't render anything, so it never needs real window or GL context
+			engine::window_settings::is_headless = true;
+			world_pregenerator_settings::is_enabled = true;
+			world_pregenerator_settings::center_x = *center_x;
+			world_pregenerator_settings::center_z = *center_z;
+			world_pregenerator_settings::radius = *radius;
+		}
+		else
+			debug::raise_warning("[game::launcher] Unknown argument '" + argument + "'");
+	}
+}
+
 void				launcher::setup_layouts()
 {
 	engine::layout_manager::add("System");
@@ -91,10 +169,18 @@ void				launcher::setup_texture_atlas()
 	game::texture_atlas::get_coordinates(game::block_type::blue_flower).set_all({12, 15});
 
 	game::texture_atlas::get_coordinates(game::block_type::mushroom).set_all({12, 14});
+
+	game::texture_atlas::freeze();
 }
 
 void				launcher::setup_biomes()
 {
+	// Stored world keeps its own config, so loaded and newly generated chunks match
+	if (game::chunk_storage::is_enabled())
+		config = game::chunk_storage::open(config);
+
+	game::biome_generator::setup(config);
+
 	game::biome_generator::register_biome<biomes::plain>(10);
 	game::biome_generator::register_biome<biomes::forest>(10);
 	game::biome_generator::register_biome<biomes::desert>(10);
@@ -105,9 +191,55 @@ void				launcher::setup_biomes()
 void 				launcher::construct_player()
 {
 	game::player::construct();
+
+	// Benchmark and stress test drive camera by themselves
+	if (streaming_benchmark_settings::is_enabled)
+		game::streaming_benchmark::construct();
+	else if (stress_test_settings::is_enabled)
+		game::stress_test::construct();
+	else if (engine::window::is_headless())
+		game::scripted_camera::construct();
 }
 
 void					launcher::setup_ui()
 {
 	game::ui::info::construct();
+}
+
+void				launcher::print_statistics()
+{
+	const int		number_of_builds = game::chunk_generation_director::get_number_of_finished_builds();
+	const float		run_time = engine::processor::get_run_time();
+
+	cout.precision(2);
+	cout << fixed;
+
+	cout << "Chunk builds : " << number_of_builds;
+	cout << " (" << (run_time > 0.f ? (float)number_of_builds / run_time : 0.f) << " per second)" << endl;
+
+	if (game::world::is_ready())
+		cout << "Warm-up : " << game::world::get_warm_up_time() << " seconds" << endl;
+	else
+		cout << "Warm-up : not finished" << endl;
+
+	if (stress_test_settings::is_enabled)
+	{
+		cout << "Stress jumps : " << game::stress_test::get_instance()->get_number_of_jumps() << endl;
+		cout << "Chunks created : " << game::world::get_number_of_created_chunks();
+		cout << ", destroyed : " << game::world::get_number_of_destroyed_chunks();
+		cout << ", alive : " << game::world::get_number_of_chunks() << endl;
+		cout << "Stress test : " << (game::stress_test::get_instance()->did_pass() ? "passed" : "failed") << endl;
+	}
+	else if (engine::window::is_headless() and not streaming_benchmark_settings::is_enabled)
+		cout << "Camera travelled : " << game::scripted_camera::get_instance()->get_travelled_distance() << " blocks" << endl;
+}
+
+bool				launcher::did_succeed()
+{
+	if (streaming_benchmark_settings::is_enabled)
+		return game::streaming_benchmark::get_instance()->did_pass();
+	if (stress_test_settings::is_enabled)
+		return game::stress_test::get_instance()->did_pass();
+
+	return true;
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include "application/common/imports/std.h"
+
+#include "game/world/world/world_config.h"
+
 namespace			game
 {
 	class 			launcher;
@@ -9,6 +13,11 @@ class				game::launcher
 {
 public :
 
+	// Supported options : --benchmark, --micro-benchmark, --report <path to json>, --noise <native | fast_noise>, --seed <number>,
+	// --determinism-check, --stress, --world <directory>, --pregenerate <center x> <center z> <radius>
+	// Center and radius of pre-generated area are in chunks
+	static void		parse_arguments(const vector<string> &arguments);
+
 	static void 	setup_layouts();
 	static void 	construct_engine_extension_objects();
 	static void 	construct_game_objects();
@@ -16,4 +25,14 @@ public :
 	static void 	setup_biomes();
 	static void 	construct_player();
 	static void 	setup_ui();
+
+	static void		print_statistics();
+
+	// False if test, that was run instead of normal game, has failed
+	static bool		did_succeed();
+
+private :
+
+	static inline world_config
+					config;
 };
\ No newline at end of file
@@ -33,17 +33,26 @@ void					player::when_updated()
 {
 	approximate_speed = 0;
 
+	if (not world::is_ready())
+		return;
+
 	process_input();
 	process_selection();
 }
 
 void					player::when_initialized()
 {
-	camera::get_instance()->subscribe(*this);
+	camera::get_instance()->subscribe<camera_position_changed_event>(*this);
+	camera::get_instance()->subscribe<camera_direction_changed_event>(*this);
 	camera::set_position(calculate_initial_position());
 }
 
-void 					player::when_notified(const engine::camera_event &event)
+void 					player::when_notified(const engine::camera_position_changed_event &event)
+{
+	should_cast_ray = true;
+}
+
+void 					player::when_notified(const engine::camera_direction_changed_event &event)
 {
 	should_cast_ray = true;
 }
@@ -171,7 +180,6 @@ vec3					player::calculate_initial_position()
 	};
 
 	const auto 			column = vec2();
-	const auto			&biome = biome_generator::generate_biome(column);
 	const auto			interpolated_height = height_interpolator(height_generator)(column);
 
 	static const float	tree_like_offset = 7.f;
@@ -203,12 +211,32 @@ aabb					player::get_aabb(const vec3 &position) const
 
 void					player::offset_camera_if_possible(const vec3 &offset) const
 {
-	const vec3			new_position = (vec3)camera::get_position() + offset;
-
 #if FT_VOX_COLLISION_CHECK
-	if (not world::world::does_collide(get_aabb(new_position)))
-		camera::set_position(new_position);
+	vec3				position = camera::get_position();
+	vec3				remaining_offset = offset;
+
+	// After each contact, part of offset that goes into touched face is dropped, so player slides along walls
+	for (int iteration = 0; iteration < player_settings::max_number_of_slides; iteration++)
+	{
+		const auto		contact = world::world::sweep(get_aabb(position), remaining_offset);
+
+		if (not contact)
+		{
+			position += remaining_offset;
+			break ;
+		}
+
+		position += remaining_offset * contact->time;
+		remaining_offset *= 1.f - contact->time;
+		remaining_offset -= contact->normal * dot(remaining_offset, contact->normal);
+
+		if (remaining_offset == vec3(0.f))
+			break ;
+	}
+
+	if (position != (vec3)camera::get_position())
+		camera::set_position(position);
 #else
-	camera::set_position(new_position);
+	camera::set_position((vec3)camera::get_position() + offset);
 #endif
 }
\ No newline at end of file
@@ -2,7 +2,8 @@
 
 #include "engine/main/core/object/object/object.h"
 #include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
-#include "engine/main/rendering/camera/camera_event/camera_event.h"
+#include "engine/main/rendering/camera/camera_event/camera_position_changed_event.h"
+#include "engine/main/rendering/camera/camera_event/camera_direction_changed_event.h"
 #include "engine/main/system/time/timer/timer.h"
 
 #include "game/world/tools/aabb/aabb.h"
@@ -16,7 +17,8 @@ namespace			game
 class				game::player :
 						public engine::object,
 						public engine::unique_object_constructor<game::player>,
-						public listener<engine::camera_event>
+						public listener<engine::camera_position_changed_event>,
+						public listener<engine::camera_direction_changed_event>
 {
 public :
 					player();
@@ -32,7 +34,8 @@ private :
 
 	void			when_initialized() override;
 	void			when_updated() override;
-	void			when_notified(const engine::camera_event &event) override;
+	void			when_notified(const engine::camera_position_changed_event &event) override;
+	void			when_notified(const engine::camera_direction_changed_event &event) override;
 
 	void 			process_input();
 	void 			process_selection();
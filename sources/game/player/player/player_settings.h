@@ -13,5 +13,8 @@ struct							game::player_settings
 	static constexpr float		speed_up = 3.f;
 
 	static constexpr vec3		aabb_size = vec3(0.3f, 1.5f, 0.3f);
+
+	// Each slide resolves one contact, three is enough to handle corner between floor and two walls
+	static constexpr int		max_number_of_slides = 3;
 };
 
@@ -1,8 +1,11 @@
 #include "ray_caster.h"
 
+#include "application/common/debug/debug.h"
+
 #include "engine/main/rendering/camera/camera/camera.h"
 
 #include "game/world/block/block_face/block_face.h"
+#include "game/world/chunk/chunk_cache/chunk_cache.h"
 #include "game/player/ray_caster/ray_caster_settings.h"
 #include "game/world/world/world.h"
 
@@ -23,75 +26,137 @@ optional<ray_caster::hit>	ray_caster::cast_ray()
 {
 	const auto				camera = engine::camera::get_instance();
 
-	float					x = floor(camera->get_position().x);
-	float					y = floor(camera->get_position().y);
-	float					z = floor(camera->get_position().z);
+	return cast_ray({camera->get_position(), camera->get_front(), ray_caster_settings::camera_ray_distance});
+}
 
-	const float 			delta_x = camera->get_front().x;
-	const float 			delta_y = camera->get_front().y;
-	const float 			delta_z = camera->get_front().z;
+optional<ray_caster::hit>	ray_caster::cast_ray(const ray &ray)
+{
+	static const auto		find_chunk = [](const ivec3 &coordinates)
+	{
+		return world::find_chunk(vec3
+		(
+			coordinates.x * chunk_settings::size[0],
+			coordinates.y * chunk_settings::size[1],
+			coordinates.z * chunk_settings::size[2]
+		));
+	};
 
-	const sign				step_x = delta_x >= 0 ? sign::plus : sign::minus;
-	const sign				step_y = delta_y >= 0 ? sign::plus : sign::minus;
-	const sign				step_z = delta_z >= 0 ? sign::plus : sign::minus;
+	if (ray.direction == vec3(0.f))
+		return nullopt;
 
-	const sign				inverted_step_x = delta_x >= 0 ? sign::minus : sign::plus;
-	const sign				inverted_step_y = delta_y >= 0 ? sign::minus : sign::plus;
-	const sign				inverted_step_z = delta_z >= 0 ? sign::minus : sign::plus;
+	// Ray, that hits nothing, stops only by distance, so it has to be finite
+	if (not debug::check(std::isfinite(ray.max_distance), "[game::ray_caster] Ray distance must be finite"))
+		return nullopt;
 
-	float					t_max_x = intbound(camera->get_position().x, delta_x);
-	float					t_max_y = intbound(camera->get_position().y, delta_y);
-	float					t_max_z = intbound(camera->get_position().z, delta_z);
+	const vec3				direction = normalize(ray.direction);
+	const ivec3				position = ivec3(floor(ray.origin));
 
-	const float				t_delta_x = (float)step_x / delta_x;
-	const float				t_delta_y = (float)step_y / delta_y;
-	const float				t_delta_z = (float)step_z / delta_z;
+	ivec3					chunk_coordinates;
+	ivec3					index;
+	shared_ptr<chunk>		chunk;
 
-	block_face				face;
-	axis					choice;
+	ivec3					step;
+	vec3					t_max;
+	vec3					t_delta;
 
-	for (int i = 0; i < ray_caster_settings::ray_cast_limit; i++)
+	for (int axis = 0; axis < 3; axis++)
 	{
-		if (t_max_x < t_max_y)
+		chunk_coordinates[axis] = chunk_cache::floor_divide(position[axis], chunk_settings::size[axis]);
+		index[axis] = position[axis] - chunk_coordinates[axis] * chunk_settings::size[axis];
+
+		step[axis] = direction[axis] >= 0.f ? 1 : -1;
+
+		if (direction[axis] != 0.f)
 		{
-			if (t_max_x < t_max_z)
-				choice = axis::x;
-			else
-				choice = axis::z;
+			t_max[axis] = intbound(ray.origin[axis], direction[axis]);
+			t_delta[axis] = (float)step[axis] / direction[axis];
 		}
 		else
 		{
-			if (t_max_y < t_max_z)
-				choice = axis::y;
-			else
-				choice = axis::z;
+			t_max[axis] = numeric_limits<float>::infinity();
+			t_delta[axis] = numeric_limits<float>::infinity();
 		}
+	}
 
-		if (choice == axis::x)
-		{
-			x += (float)step_x;
-			t_max_x += t_delta_x;
-			face = from_axis_and_sign(axis::x, inverted_step_x);
-		}
-		else if (choice == axis::y)
-		{
-			y += (float)step_y;
-			t_max_y += t_delta_y;
-			face = from_axis_and_sign(axis::y, inverted_step_y);
-		}
-		else if (choice == axis::z)
+	chunk = find_chunk(chunk_coordinates);
+
+	while (true)
+	{
+		int					choice;
+
+		if (t_max.x < t_max.y)
+			choice = t_max.x < t_max.z ? 0 : 2;
+		else
+			choice = t_max.y < t_max.z ? 1 : 2;
+
+		const float			distance = t_max[choice];
+
+		if (distance > ray.max_distance)
+			return nullopt;
+
+		t_max[choice] += t_delta[choice];
+		index[choice] += step[choice];
+
+		if (index[choice] < 0 or index[choice] >= chunk_settings::size[choice])
 		{
-			z += (float)step_z;
-			t_max_z += t_delta_z;
-			face = from_axis_and_sign(axis::z, inverted_step_z);
+			index[choice] -= step[choice] * chunk_settings::size[choice];
+			chunk_coordinates[choice] += step[choice];
+			chunk = find_chunk(chunk_coordinates);
 		}
 
-		if (auto block = game::world::find_block(vec3(x, y, z)); block != nullptr)
+		if (chunk == nullptr)
+			continue ;
+
+		if (is_editable(get_meta_type(chunk->at(index.x, index.y, index.z).get_type())))
 		{
-			if (is_editable(get_meta_type(block->get_type())))
-				return {{block, face}};
+			hit				result;
+
+			result.block = block_ptr(chunk, chunk::index(index.x, index.y, index.z));
+			result.face = from_axis_and_sign((axis)choice, step[choice] > 0 ? sign::minus : sign::plus);
+			result.distance = distance;
+
+			return result;
 		}
 	}
-
-	return {};
 }
+
+vector<optional<ray_caster::hit>>
+							ray_caster::cast_rays(const vector<ray> &rays)
+{
+	const int				number_of_rays = (int)rays.size();
+	const int				max_number_of_threads = max(1, (int)thread::hardware_concurrency());
+	const int				number_of_threads = clamp
+							(
+								number_of_rays / ray_caster_settings::min_number_of_rays_per_thread,
+								1,
+								max_number_of_threads
+							);
+
+	const int				rays_per_thread = (number_of_rays + number_of_threads - 1) / number_of_threads;
+
+	vector<optional<hit>>	hits(number_of_rays);
+	vector<future<void>>	futures;
+
+	const auto				cast_range = [&rays, &hits](int begin, int end)
+	{
+		for (int index = begin; index < end; index++)
+			hits[index] = cast_ray(rays[index]);
+	};
+
+	// Calling thread takes first range itself instead of waiting idle
+	for (int thread_index = 1; thread_index < number_of_threads; thread_index++)
+	{
+		const int			begin = thread_index * rays_per_thread;
+		const int			end = min(begin + rays_per_thread, number_of_rays);
+
+		if (begin < end)
+			futures.push_back(async(launch::async, cast_range, begin, end));
+	}
+
+	cast_range(0, min(rays_per_thread, number_of_rays));
+
+	for (auto &future : futures)
+		future.wait();
+
+	return hits;
+}
\ No newline at end of file
@@ -8,17 +8,31 @@ namespace					game
 	class 					ray_caster;
 }
 
+// Walks voxel grid along ray and stops at first editable block.
+// Current chunk is kept between steps, so chunk map is only touched when ray crosses chunk border.
 class						game::ray_caster
 {
 public :
 
+	struct					ray
+	{
+		vec3				origin;
+		vec3				direction;
+		float				max_distance;
+	};
+
 	struct					hit
 	{
 		block_ptr			block;
 		block_face			face;
+		float				distance;
 	};
 
+	// Casts ray from camera in direction of view
 	static optional<hit>	cast_ray();
-};
-
+	static optional<hit>	cast_ray(const ray &ray);
 
+	// Splits rays between threads and blocks until all of them are cast, result has same order as rays
+	static vector<optional<hit>>
+							cast_rays(const vector<ray> &rays);
+};
\ No newline at end of file
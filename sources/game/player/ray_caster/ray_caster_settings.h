@@ -9,5 +9,8 @@ namespace				game
 
 struct					game::ray_caster_settings
 {
-	static inline int	ray_cast_limit = 15;
+	static inline float	camera_ray_distance = 10.f;
+
+	// Batches smaller than this are cast on calling thread
+	static inline int	min_number_of_rays_per_thread = 256;
 };
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "scripted_camera.h"
+
+#include "engine/main/rendering/camera/camera/camera.h"
+
+#include "game/world/world/world.h"
+
+#include "game/player/scripted_camera/scripted_camera_settings.h"
+
+using namespace		engine;
+using namespace		game;
+
+					scripted_camera::scripted_camera()
+{
+	set_layout("System");
+
+	travelled_distance = 0.f;
+}
+
+float				scripted_camera::get_travelled_distance() const
+{
+	return travelled_distance;
+}
+
+void				scripted_camera::when_updated()
+{
+	if (not world::is_ready())
+		return;
+
+	const auto		offset = normalize(scripted_camera_settings::direction) * scripted_camera_settings::step;
+
+	camera::set_position(camera::get_position() + offset);
+	travelled_distance += scripted_camera_settings::step;
+}
\ No newline at end of file
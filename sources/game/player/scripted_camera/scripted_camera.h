@@ -0,0 +1,27 @@
+#pragma once
+
+#include "engine/main/core/object/object/object.h"
+#include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
+
+namespace			game
+{
+	class			scripted_camera;
+}
+
+// Moves camera along a straight line instead of player, used in headless runs
+class				game::scripted_camera :
+						public engine::object,
+						public engine::unique_object_constructor<game::scripted_camera>
+{
+public :
+					scripted_camera();
+					~scripted_camera() override = default;
+
+	float			get_travelled_distance() const;
+
+private :
+
+	float			travelled_distance;
+
+	void			when_updated() override;
+};
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+
+namespace						game
+{
+	struct 						scripted_camera_settings;
+}
+
+struct							game::scripted_camera_settings
+{
+	// Camera moves by fixed step each frame, so runs are comparable regardless of frame rate
+	static inline vec3			direction = vec3(1.f, 0.f, 0.f);
+	static inline float			step = 0.5f;
+};
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "world_pregenerator.h"
+
+#include "application/common/debug/debug.h"
+
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/chunk_storage/chunk_storage.h"
+#include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_surface_generation_task/chunk_surface_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_landscape_generation_task/chunk_landscape_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_decoration_generation_task/chunk_decoration_generation_task.h"
+#include "game/pregenerator/world_pregenerator/world_pregenerator_settings.h"
+
+using namespace					game;
+
+bool							world_pregenerator::run()
+{
+	if (not chunk_storage::is_enabled())
+	{
+		debug::raise_warning("[game::world_pregenerator] World directory isn't set");
+		return false;
+	}
+
+	const int					first_row = world_pregenerator_settings::center_x - world_pregenerator_settings::radius;
+	const int					last_row = world_pregenerator_settings::center_x + world_pregenerator_settings::radius;
+	const int					number_of_rows = last_row - first_row + 1;
+
+	const int					number_of_threads = world_pregenerator_settings::number_of_threads > 0 ?
+								world_pregenerator_settings::number_of_threads : max(1, (int)thread::hardware_concurrency());
+
+	pending_block_writes		pending_writes;
+	map<int, row>				rows;
+
+	int							number_of_generated_chunks = 0;
+	int							number_of_saved_chunks = 0;
+	const auto					start = engine::clock::now();
+
+	cout.precision(2);
+	cout << fixed;
+
+	// Row is generated if it or one of its neighbors has unsaved chunks, and saved one step later,
+	// when the next row has placed its structures
+	for (int x = first_row; x <= last_row + 1; x++)
+	{
+		const bool				is_needed =
+		(
+			x <= last_row and
+			(
+				not is_row_stored(x) or
+				(x > first_row and not is_row_stored(x - 1)) or
+				(x < last_row and not is_row_stored(x + 1))
+			)
+		);
+
+		if (is_needed)
+		{
+			rows[x] = create_row(x);
+			generate_row(rows[x], pending_writes, number_of_threads);
+			number_of_generated_chunks += (int)rows[x].size();
+		}
+
+		if (auto iterator = rows.find(x - 1); iterator != rows.end())
+		{
+			number_of_saved_chunks += save_row(iterator->second, pending_writes, number_of_threads);
+
+			const float			time = engine::clock::get_seconds_since(start);
+
+			cout << "Rows : " << x - first_row << " / " << number_of_rows;
+			cout << ", saved chunks : " << number_of_saved_chunks;
+			cout << ", chunks per second : " << (time > 0.f ? (float)number_of_generated_chunks / time : 0.f) << endl;
+		}
+
+		if (auto iterator = rows.find(x - 2); iterator != rows.end())
+		{
+			for (const auto &chunk : iterator->second)
+				pending_writes.discard(chunk->get_position());
+
+			rows.erase(iterator);
+		}
+	}
+
+	cout << "Pre-generation is finished : " << number_of_saved_chunks << " chunks saved, ";
+	cout << number_of_generated_chunks << " generated in " << engine::clock::get_seconds_since(start) << " s" << endl;
+
+	for (int x = first_row; x <= last_row; x++)
+	{
+		if (not is_row_stored(x))
+			return false;
+	}
+
+	return true;
+}
+
+world_pregenerator::row			world_pregenerator::create_row(int x)
+{
+	const int					first_column = world_pregenerator_settings::center_z - world_pregenerator_settings::radius;
+	const int					last_column = world_pregenerator_settings::center_z + world_pregenerator_settings::radius;
+
+	row							row;
+
+	for (int z = first_column; z <= last_column; z++)
+		row.push_back(make_shared<chunk>(vec3(x * chunk_settings::size[0], 0, z * chunk_settings::size[2])));
+
+	return row;
+}
+
+bool							world_pregenerator::is_row_stored(int x)
+{
+	const int					first_column = world_pregenerator_settings::center_z - world_pregenerator_settings::radius;
+	const int					last_column = world_pregenerator_settings::center_z + world_pregenerator_settings::radius;
+
+	for (int z = first_column; z <= last_column; z++)
+	{
+		if (not chunk_storage::exists(vec3(x * chunk_settings::size[0], 0, z * chunk_settings::size[2])))
+			return false;
+	}
+
+	return true;
+}
+
+void							world_pregenerator::generate_row(const row &row, pending_block_writes &pending_writes, int number_of_threads)
+{
+	run_on_threads(row, number_of_threads, [&pending_writes](const shared_ptr<chunk> &chunk)
+	{
+		chunk_workspace						workspace(chunk);
+
+		chunk_surface_generation_task		surface_task;
+		chunk_landscape_generation_task		landscape_task(biome_generator::get_config());
+		chunk_decoration_generation_task	decoration_task(pending_writes);
+
+		surface_task.execute(workspace);
+		landscape_task.execute(workspace);
+		decoration_task.execute(workspace);
+	});
+}
+
+int								world_pregenerator::save_row(const row &row, const pending_block_writes &pending_writes, int number_of_threads)
+{
+	atomic<int>					number_of_saved_chunks = 0;
+
+	run_on_threads(row, number_of_threads, [&pending_writes, &number_of_saved_chunks](const shared_ptr<chunk> &chunk)
+	{
+		if (chunk_storage::exists(chunk->get_position()))
+			return;
+
+		pending_writes.apply(*chunk);
+
+		if (chunk_storage::save(*chunk, pending_writes.find(chunk->get_position())))
+			number_of_saved_chunks++;
+	});
+
+	return number_of_saved_chunks;
+}
+
+void							world_pregenerator::run_on_threads
+								(
+									const row &row,
+									int number_of_threads,
+									const function<void(const shared_ptr<chunk> &)> &work
+								)
+{
+	vector<future<void>>		futures;
+
+	for (int thread_index = 0; thread_index < number_of_threads; thread_index++)
+	{
+		futures.push_back(async(launch::async, [&row, &work, thread_index, number_of_threads]()
+		{
+			for (int index = thread_index; index < (int)row.size(); index += number_of_threads)
+				work(row[index]);
+		}));
+	}
+
+	for (auto &future : futures)
+		future.wait();
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace							game
+{
+	class							chunk;
+	class							pending_block_writes;
+	class							world_pregenerator;
+}
+
+// Generates area of world without rendering and writes it to chunk storage, so game started later loads it from disk.
+// Area is processed row by row : row is generated when its neighbor rows are needed, and saved after both neighbor
+// rows are decorated, so only three rows are kept in memory. Chunks, that are already stored, aren't saved again,
+// so interrupted run can be continued by starting it with same arguments.
+class								game::world_pregenerator
+{
+public :
+
+	// Returns false if area couldn't be saved
+	static bool						run();
+
+private :
+
+	using							row = vector<shared_ptr<chunk>>;
+
+	static row						create_row(int x);
+	static bool						is_row_stored(int x);
+
+	static void						generate_row(const row &row, pending_block_writes &pending_writes, int number_of_threads);
+
+	// Returns number of saved chunks
+	static int						save_row(const row &row, const pending_block_writes &pending_writes, int number_of_threads);
+
+	static void						run_on_threads
+									(
+										const row &row,
+										int number_of_threads,
+										const function<void(const shared_ptr<chunk> &)> &work
+									);
+};
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						world_pregenerator_settings;
+}
+
+struct							game::world_pregenerator_settings
+{
+	static inline bool			is_enabled = false;
+
+	// Area is square of chunks, center is given in chunk coordinates
+	static inline int			center_x = 0;
+	static inline int			center_z = 0;
+	static inline int			radius = 16;
+
+	// Zero means number of hardware threads
+	static inline int			number_of_threads = 0;
+};
\ No newline at end of file
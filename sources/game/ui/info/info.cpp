@@ -2,11 +2,16 @@
 
 #include "engine/main/system/window/window/window.h"
 #include "engine/main/rendering/camera/camera/camera.h"
+#include "engine/main/rendering/gl_call_counter/gl_call_counter.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
 #include "engine/extensions/ui/font/font/font.h"
 #include "engine/extensions/ui/text/text.h"
 #include "engine/extensions/utilities/fps_counter/fps_counter.h"
 
+#include "game/world/world/world.h"
 #include "game/world/world/world_settings.h"
+#include "game/world/far_terrain/far_terrain/far_terrain.h"
+#include "game/world/chunk/generation/chunk_generation_budget/chunk_generation_budget.h"
 #include "game/player/player/player.h"
 
 using namespace			game::ui;
@@ -25,12 +30,29 @@ void 					info::when_initialized()
 	const auto			visibility_position = get_next_label_position();
 	const auto			speed_position = get_next_label_position();
 	const auto			position_position = get_next_label_position();
+	const auto			gl_calls_position = get_next_label_position();
+	const auto			chunks_position = get_next_label_position();
+	const auto			far_terrain_position = get_next_label_position();
+	const auto			frame_time_position = get_next_label_position();
+	const auto			frame_graph_position = get_next_label_position();
+	const auto			generation_budget_position = get_next_label_position();
+	const auto			warm_up_position = get_next_label_position();
 
 	ui_fps = engine::ui::text::create(fps_position, font, "");
 	ui_fov = engine::ui::text::create(fov_position, font, "");
 	ui_visibility = engine::ui::text::create(visibility_position, font, "");
 	ui_speed = engine::ui::text::create(speed_position, font, "");
 	ui_position = engine::ui::text::create(position_position, font, "");
+	ui_gl_calls = engine::ui::text::create(gl_calls_position, font, "");
+	ui_chunks = engine::ui::text::create(chunks_position, font, "");
+	ui_far_terrain = engine::ui::text::create(far_terrain_position, font, "");
+	ui_frame_time = engine::ui::text::create(frame_time_position, font, "");
+	ui_frame_graph = engine::ui::text::create(frame_graph_position, font, "");
+	ui_generation_budget = engine::ui::text::create(generation_budget_position, font, "");
+	ui_warm_up = engine::ui::text::create(warm_up_position, font, "");
+
+	for (auto &ui_profiled_section : ui_profiled_sections)
+		ui_profiled_section = engine::ui::text::create(get_next_label_position(), font, "");
 }
 
 void 					info::when_updated()
@@ -40,12 +62,31 @@ void 					info::when_updated()
 	const auto			visibility = world_settings::visibility_limit[world_settings::current_visibility_option];
 	const auto			speed = player::get_instance()->get_approximate_speed();
 	const auto			position = engine::camera::get_position();
+	const auto			gl_calls = engine::gl_call_counter::get_total_calls();
+	const auto			draw_calls = engine::gl_call_counter::get_calls(engine::gl_call_counter::type::draw);
 
 	ui_fps->set_string(format_fps(fps));
 	ui_fov->set_string(format_fov(fov));
 	ui_visibility->set_string(format_visibility(visibility));
 	ui_speed->set_string(format_speed(speed));
 	ui_position->set_string(format_position(position));
+	ui_gl_calls->set_string(format_gl_calls(gl_calls, draw_calls));
+	ui_chunks->set_string(format_chunks(world::get_number_of_rendered_chunks(), world::get_number_of_renderable_chunks()));
+	ui_far_terrain->set_string(format_far_terrain());
+	ui_frame_time->set_string(format_frame_time());
+	ui_frame_graph->set_string(format_frame_graph());
+	ui_generation_budget->set_string(format_generation_budget(chunk_generation_budget::get_budget(), chunk_generation_budget::get_backlog()));
+	ui_warm_up->set_string(format_warm_up());
+
+	const auto			heaviest_sections = find_heaviest_sections();
+
+	for (int index = 0; index < number_of_profiled_sections; index++)
+	{
+		if (index < (int)heaviest_sections.size())
+			ui_profiled_sections[index]->set_string(format_profiled_section(heaviest_sections[index]));
+		else
+			ui_profiled_sections[index]->set_string("");
+	}
 }
 
 ivec2					info::get_next_label_position()
@@ -96,4 +137,127 @@ string 					info::format_position(const vec3 &position)
 		to_string((int)position.y) + ", " +
 		to_string((int)position.z)
 	);
+}
+
+string 					info::format_gl_calls(int calls, int draw_calls)
+{
+	return "GL calls : " + to_string(calls) + " (" + to_string(draw_calls) + " draws)";
+}
+
+string 					info::format_chunks(int rendered_chunks, int renderable_chunks)
+{
+	return "Chunks : " + to_string(rendered_chunks) + " / " + to_string(renderable_chunks);
+}
+
+string 					info::format_far_terrain()
+{
+	stringstream		stream;
+
+	stream.precision(2);
+	stream << "LOD ms :";
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+		stream << (level == 0 ? " " : " / ") << fixed << far_terrain::get_average_generation_time(level);
+
+	return stream.str();
+}
+
+string 					info::format_frame_time()
+{
+	stringstream		stream;
+
+	stream.precision(2);
+	stream << "Frame ms : " << fixed << engine::profiler::get_average_frame_time() * 1000.f;
+	stream << " / max " << fixed << engine::profiler::get_max_frame_time() * 1000.f;
+
+	return stream.str();
+}
+
+string 					info::format_frame_graph()
+{
+	static const string	levels = " .:-=+*#";
+
+	const int			number_of_frames = engine::profiler::get_number_of_recorded_frames();
+	const int			frames_per_column = max(1, number_of_frames / frame_graph_width);
+	const float			max_frame_time = engine::profiler::get_max_frame_time();
+
+	string				graph;
+
+	if (max_frame_time <= 0.f)
+		return graph;
+
+	// Each column shows the worst frame of its group, scaled relatively to the worst frame overall
+	for (int first_frame = 0; first_frame + frames_per_column <= number_of_frames; first_frame += frames_per_column)
+	{
+		float			column_time = 0.f;
+
+		for (int frame = first_frame; frame < first_frame + frames_per_column; frame++)
+			column_time = max(column_time, engine::profiler::get_frame_time(frame));
+
+		graph += levels[(int)(column_time / max_frame_time * (float)(levels.size() - 1))];
+	}
+
+	return graph;
+}
+
+string 					info::format_generation_budget(float budget, int backlog)
+{
+	stringstream		stream;
+
+	stream.precision(2);
+	stream << "Budget ms : " << fixed << budget * 1000.f << " (" << backlog << " behind)";
+
+	return stream.str();
+}
+
+string 					info::format_warm_up()
+{
+	stringstream		stream;
+
+	if (world::is_ready())
+	{
+		stream.precision(2);
+		stream << "Warm-up : " << fixed << world::get_warm_up_time() << " sec";
+	}
+	else
+	{
+		const auto		[number_of_built_chunks, number_of_chunks] = world::get_warm_up_progress();
+
+		stream << "Warm-up : " << number_of_built_chunks << " / " << number_of_chunks << " chunks";
+	}
+
+	return stream.str();
+}
+
+string 					info::format_profiled_section(int section)
+{
+	stringstream		stream;
+
+	stream.precision(2);
+	stream << engine::profiler::get_section_name(section) << " : ";
+	stream << fixed << engine::profiler::get_average_time(section) * 1000.f;
+	stream << " / " << fixed << engine::profiler::get_max_time(section) * 1000.f;
+
+	return stream.str();
+}
+
+vector<int>				info::find_heaviest_sections()
+{
+	vector<int>			sections;
+
+	for (int section = 0; section < engine::profiler::get_number_of_sections(); section++)
+	{
+		if (engine::profiler::get_section_type(section) == engine::profiler::section_type::time)
+			sections.push_back(section);
+	}
+
+	sort(sections.begin(), sections.end(), [](int left, int right)
+	{
+		return engine::profiler::get_average_time(left) > engine::profiler::get_average_time(right);
+	});
+
+	if ((int)sections.size() > number_of_profiled_sections)
+		sections.resize(number_of_profiled_sections);
+
+	return sections;
 }
\ No newline at end of file
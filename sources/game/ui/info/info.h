@@ -20,6 +20,9 @@ class								game::ui::info :
 {
 public :
 
+	static constexpr int			number_of_profiled_sections = 4;
+	static constexpr int			frame_graph_width = 30;
+
 									info();
 									~info() override = default;
 
@@ -30,6 +33,15 @@ private :
 	shared_ptr<engine::ui::text>	ui_visibility;
 	shared_ptr<engine::ui::text>	ui_speed;
 	shared_ptr<engine::ui::text>	ui_position;
+	shared_ptr<engine::ui::text>	ui_gl_calls;
+	shared_ptr<engine::ui::text>	ui_chunks;
+	shared_ptr<engine::ui::text>	ui_far_terrain;
+	shared_ptr<engine::ui::text>	ui_frame_time;
+	shared_ptr<engine::ui::text>	ui_frame_graph;
+	shared_ptr<engine::ui::text>	ui_generation_budget;
+	shared_ptr<engine::ui::text>	ui_warm_up;
+	array<shared_ptr<engine::ui::text>, number_of_profiled_sections>
+									ui_profiled_sections;
 
 	void 							when_initialized() override;
 	void 							when_updated() override;
@@ -41,4 +53,14 @@ private :
 	static string					format_visibility(float visibility);
 	static string 					format_speed(float speed);
 	static string 					format_position(const vec3 &position);
+	static string 					format_gl_calls(int calls, int draw_calls);
+	static string 					format_chunks(int rendered_chunks, int renderable_chunks);
+	static string 					format_far_terrain();
+	static string 					format_frame_time();
+	static string 					format_frame_graph();
+	static string 					format_generation_budget(float budget, int backlog);
+	static string 					format_warm_up();
+	static string 					format_profiled_section(int section);
+
+	static vector<int>				find_heaviest_sections();
 };
\ No newline at end of file
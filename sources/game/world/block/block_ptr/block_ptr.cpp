@@ -1,6 +1,5 @@
 #include "block_ptr.h"
 
-#include "game/world/tools/aabb/aabb.h"
 #include "game/world/tools/array3/array3.h"
 #include "game/world/world/world.h"
 
@@ -104,17 +103,4 @@ block_ptr					block_ptr::get_neighbor(const chunk::index &offset) const
 vec3						block_ptr::get_world_position() const
 {
 	return chunk->get_position() + (vec3)index;
-}
-
-aabb						block_ptr::get_aabb() const
-{
-	static const vec3		epsilon = vec3(0.08f);
-
-	vec3					min = get_world_position();
-	vec3					max = get_world_position() + vec3(1.f);
-
-	min -= epsilon;
-	max += epsilon;
-
-	return {min, max};
 }
\ No newline at end of file
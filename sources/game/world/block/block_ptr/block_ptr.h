@@ -9,8 +9,6 @@ namespace					game
 	enum class 				axis;
 	enum class 				sign;
 
-	class					aabb;
-
 	class					block;
 	class					world;
 
@@ -41,7 +39,6 @@ public :
 	block_ptr				get_neighbor(axis axis, sign sign) const;
 	block_ptr				get_neighbor(const chunk::index &offset) const;
 	vec3					get_world_position() const;
-	aabb					get_aabb() const;
 
 private :
 
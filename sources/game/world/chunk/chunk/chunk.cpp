@@ -3,8 +3,10 @@
 #include "application/common/defines.h"
 
 #include "engine/main/rendering/model/model/model.h"
+#include "engine/main/rendering/camera/camera/camera.h"
 
 #include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
+#include "game/world/world/world_settings.h"
 
 using namespace				game;
 
@@ -35,11 +37,34 @@ bool						chunk::is_valid() const
 	);
 }
 
+bool						chunk::is_renderable() const
+{
+	return is_valid() and is_visible;
+}
+
 void						chunk::set_visible(bool state)
 {
 	is_visible = state;
 }
 
+section_connectivity		chunk::get_connectivity(int section) const
+{
+	// Chunks without geometry don't occlude anything
+	if (not connectivity)
+		return section_connectivity::all();
+	return (*connectivity)[section];
+}
+
+surface_map					&chunk::get_surface_map()
+{
+	return surface;
+}
+
+const surface_map			&chunk::get_surface_map() const
+{
+	return surface;
+}
+
 void						chunk::update_build()
 {
 	shared_ptr<chunk>		pointer = shared_from_this();
@@ -50,7 +75,13 @@ void						chunk::update_build()
 		model_for_opaque = build->model_for_opaque;
 		model_for_transparent = build->model_for_transparent;
 		model_for_partially_transparent = build->model_for_partially_transparent;
+		transparent_quad_centers = move(build->transparent_quad_centers);
+		transparent_indices = move(build->transparent_indices);
+		connectivity = build->connectivity;
 		is_built = true;
+
+		if (glm::distance(center, engine::camera::get_position()) < world_settings::transparency_sorting_limit)
+			sort_transparent_quads(engine::camera::get_position());
 	}
 }
 
@@ -78,4 +109,37 @@ void						chunk::reset_build()
 void 						chunk::delete_build()
 {
 	chunk_generation_director::delete_build(shared_from_this());
+}
+
+void						chunk::sort_transparent_quads(const vec3 &observer)
+{
+	const int				number_of_quads = (int)transparent_quad_centers.size();
+	const vec3				local_observer = observer - position - vec3(0.5f);
+
+	vector<pair<float, int>>	quads_by_distance;
+
+	if (model_for_transparent == nullptr or number_of_quads == 0)
+		return ;
+
+	quads_by_distance.reserve(number_of_quads);
+	for (int i = 0; i < number_of_quads; i++)
+	{
+		const vec3			delta = transparent_quad_centers[i] - local_observer;
+
+		quads_by_distance.emplace_back(dot(delta, delta), i);
+	}
+
+	// Far-to-near, so blending of overlapping water quads is correct
+	sort(quads_by_distance.begin(), quads_by_distance.end(), greater<>());
+
+	sorted_transparent_indices.resize(transparent_indices.size());
+	for (int i = 0; i < number_of_quads; i++)
+	{
+		const int			quad = quads_by_distance[i].second;
+
+		for (int j = 0; j < 6; j++)
+			sorted_transparent_indices[i * 6 + j] = transparent_indices[quad * 6 + j];
+	}
+
+	model_for_transparent->update_ebo(sorted_transparent_indices);
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "game/world/tools/array3/array3.h"
 #include "game/world/block/block/block.h"
 #include "game/world/chunk/chunk/chunk_settings.h"
+#include "game/world/chunk/section_connectivity/section_connectivity.h"
+#include "game/world/chunk/surface_map/surface_map.h"
 
 #include "application/common/imports/opengl.h"
 #include "application/common/imports/std.h"
@@ -46,14 +48,22 @@ public :
 	vec3							get_center() const;
 
 	bool							is_valid() const;
+	bool							is_renderable() const;
 
 	void							set_visible(bool state);
 
+	section_connectivity			get_connectivity(int section) const;
+
+	surface_map						&get_surface_map();
+	const surface_map				&get_surface_map() const;
+
 	void							update_build();
 	void							update_build_if_needed();
 	void							reset_build();
 	void 							delete_build();
 
+	void							sort_transparent_quads(const vec3 &observer);
+
 private :
 
 	const vec3						position;
@@ -63,6 +73,15 @@ private :
 	shared_ptr<engine::model>		model_for_transparent;
 	shared_ptr<engine::model>		model_for_partially_transparent;
 
+	vector<vec3>					transparent_quad_centers;
+	vector<GLuint>					transparent_indices;
+	vector<GLuint>					sorted_transparent_indices;
+
+	optional<array<section_connectivity, chunk_settings::number_of_sections>>
+									connectivity;
+
+	surface_map						surface;
+
 	bool							is_built;
 	bool							is_visible;
 };
\ No newline at end of file
@@ -18,4 +18,8 @@ struct							game::chunk_settings
 	using						underlying_array = array3<block, chunk_settings::size[0], chunk_settings::size[1], chunk_settings::size[2]>;
 
 	static constexpr int		zero_height = 60;
+
+	// Chunk is split vertically into sections for occlusion culling
+	static constexpr int		section_height = 16;
+	static constexpr int		number_of_sections = size[1] / section_height;
 };
\ No newline at end of file
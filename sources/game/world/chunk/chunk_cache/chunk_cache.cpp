@@ -0,0 +1,70 @@
+#include "chunk_cache.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/chunk_map/chunk_map.h"
+#include "game/world/block/block_type/block_meta_type/block_meta_type.h"
+
+using namespace			game;
+
+						chunk_cache::chunk_cache(const chunk_map &chunks, const ivec3 &min, const ivec3 &max)
+{
+	ivec3				max_chunk;
+
+	min_chunk.x = floor_divide(min.x, chunk_settings::size[0]);
+	min_chunk.y = floor_divide(min.y, chunk_settings::size[1]);
+	min_chunk.z = floor_divide(min.z, chunk_settings::size[2]);
+
+	max_chunk.x = floor_divide(max.x, chunk_settings::size[0]);
+	max_chunk.y = floor_divide(max.y, chunk_settings::size[1]);
+	max_chunk.z = floor_divide(max.z, chunk_settings::size[2]);
+
+	number_of_chunks = max_chunk - min_chunk + ivec3(1);
+
+	chunks.find(min_chunk, max_chunk, this->chunks);
+}
+
+const block				*chunk_cache::find(const ivec3 &position) const
+{
+	const ivec3			chunk_coordinates = ivec3
+	(
+		floor_divide(position.x, chunk_settings::size[0]),
+		floor_divide(position.y, chunk_settings::size[1]),
+		floor_divide(position.z, chunk_settings::size[2])
+	);
+
+	const ivec3			offset = chunk_coordinates - min_chunk;
+
+	if
+	(
+		offset.x < 0 or offset.x >= number_of_chunks.x or
+		offset.y < 0 or offset.y >= number_of_chunks.y or
+		offset.z < 0 or offset.z >= number_of_chunks.z
+	)
+	{
+		return nullptr;
+	}
+
+	const auto			&chunk = chunks[(offset.x * number_of_chunks.y + offset.y) * number_of_chunks.z + offset.z];
+
+	if (chunk == nullptr)
+		return nullptr;
+
+	return &chunk->at
+	(
+		position.x - chunk_coordinates.x * chunk_settings::size[0],
+		position.y - chunk_coordinates.y * chunk_settings::size[1],
+		position.z - chunk_coordinates.z * chunk_settings::size[2]
+	);
+}
+
+bool					chunk_cache::is_solid(const ivec3 &position) const
+{
+	const block			*block = find(position);
+
+	return block != nullptr and game::is_solid(get_meta_type(block->get_type()));
+}
+
+int						chunk_cache::floor_divide(int value, int divisor)
+{
+	return value / divisor - (value % divisor != 0 and (value < 0) != (divisor < 0));
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "game/world/block/block/block.h"
+
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	class						chunk;
+	class						chunk_map;
+	class						chunk_cache;
+}
+
+// Resolves all chunks covering given block range once, so following block lookups are plain integer arithmetic.
+// Keeps resolved chunks alive while cache exists.
+class							game::chunk_cache
+{
+public :
+								chunk_cache(const chunk_map &chunks, const ivec3 &min, const ivec3 &max);
+								~chunk_cache() = default;
+
+	// Returns nullptr if block is outside of resolved range or its chunk isn't loaded
+	const block					*find(const ivec3 &position) const;
+
+	bool						is_solid(const ivec3 &position) const;
+
+	static int					floor_divide(int value, int divisor);
+
+private :
+
+	ivec3						min_chunk;
+	ivec3						number_of_chunks;
+
+	vector<shared_ptr<chunk>>	chunks;
+};
\ No newline at end of file
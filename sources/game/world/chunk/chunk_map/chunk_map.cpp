@@ -50,6 +50,35 @@ shared_ptr<chunk>		chunk_map::find(const vec3 &position) const
 		return nullptr;
 }
 
+void					chunk_map::find(const ivec3 &min, const ivec3 &max, vector<shared_ptr<chunk>> &result) const
+{
+	shared_lock			lock{mutex};
+	vec3				position;
+
+	result.clear();
+
+	for (int x = min.x; x <= max.x; x++)
+	for (int y = min.y; y <= max.y; y++)
+	for (int z = min.z; z <= max.z; z++)
+	{
+		position.x = (float)(x * chunk_settings::size[0]);
+		position.y = (float)(y * chunk_settings::size[1]);
+		position.z = (float)(z * chunk_settings::size[2]);
+
+		if (auto iterator = parent::find(position); iterator != this->cend())
+			result.push_back(iterator->second);
+		else
+			result.push_back(nullptr);
+	}
+}
+
+int						chunk_map::get_size() const
+{
+	shared_lock			lock{mutex};
+
+	return (int)parent::size();
+}
+
 chunk_map::iterator		chunk_map::begin()
 {
 	return parent::cbegin();
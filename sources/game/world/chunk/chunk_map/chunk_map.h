@@ -36,6 +36,11 @@ public :
 
 	shared_ptr<chunk>			find(const vec3 &position) const;
 
+	// Looks up every chunk in given range of chunk coordinates under single lock, missing chunks are nullptr
+	void						find(const ivec3 &min, const ivec3 &max, vector<shared_ptr<chunk>> &result) const;
+
+	int							get_size() const;
+
 	iterator					begin();
 	iterator					end();
 
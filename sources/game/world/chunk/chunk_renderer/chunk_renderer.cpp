@@ -4,6 +4,8 @@
 #include "engine/main/rendering/model/model/model.h"
 #include "engine/main/rendering/camera/camera/camera.h"
 #include "engine/main/rendering/program/program/program.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/profiler/scoped_timer/scoped_timer.h"
 
 #include "game/world/texture_atlas/texture_atlas/texture_atlas.h"
 #include "game/world/chunk/chunk/chunk.h"
@@ -42,53 +44,124 @@ void					chunk_renderer::set_apply_water_tint(bool value)
 	get_instance()->apply_water_tint = value;
 }
 
-void					chunk_renderer::render(const shared_ptr<chunk> &chunk, group group)
+void					chunk_renderer::enqueue(const shared_ptr<chunk> &chunk, group group)
 {
-	if (not chunk->is_valid() or not chunk->is_visible)
+	shared_ptr<engine::model>
+						model;
+
+	if (not chunk->is_renderable())
 		return ;
 
 	switch (group)
 	{
 		case (group::opaque) :
-			render(chunk->model_for_opaque);
+			model = chunk->model_for_opaque;
 			break ;
 
 		case (group::transparent) :
-			render(chunk->model_for_transparent);
+			model = chunk->model_for_transparent;
 			break ;
 
 		case (group::partially_transparent) :
-			render(chunk->model_for_partially_transparent, 0.8f);
+			model = chunk->model_for_partially_transparent;
 			break ;
 	}
+
+	enqueue(model, group);
 }
 
-void					chunk_renderer::render
-						(
-							const shared_ptr<engine::model> &model,
-							float alpha_discard_floor
-						)
+void					chunk_renderer::enqueue(const shared_ptr<engine::model> &model, group group)
 {
+	if (!debug::check(model != nullptr, "[game::chunk_renderer] Model is nullptr"))
+		return;
+
+	get_instance()->queues[(int)group].push_back(model);
+}
+
+void					chunk_renderer::render_queue()
+{
+	static const int	section = profiler::register_section("Chunk renderer");
+	scoped_timer		profiling_timer(section);
+
 	const auto 			instance = get_instance();
 
-	if (!debug::check(model != nullptr, "[game::chunk_renderer] Model is nullptr"))
+	if (not instance->is_batching_enabled)
+	{
+		for (auto group : render_order)
+			instance->render_group_without_batching(group);
 		return;
+	}
 
 	instance->program->use(true);
+	instance->upload_frame_uniforms();
 
-	instance->uniform_projection.upload(camera::get_instance()->get_projection_matrix());
-	instance->uniform_view.upload(camera::get_instance()->get_view_matrix());
-	instance->uniform_fog_density.upload(1.f / (world_settings::fog_limit[world_settings::current_visibility_option]));
-	instance->uniform_alpha_discard_floor.upload(alpha_discard_floor);
-	instance->uniform_apply_water_tint.upload(get_instance()->apply_water_tint);
-
-	model->use(true);
 	texture_atlas::use(true);
 
-	instance->uniform_transformation.upload(model->get_transformation());
-	model->render();
+	for (auto group : render_order)
+		instance->render_group(group);
 
 	texture_atlas::use(false);
-	model->use(false);
 	instance->program->use(false);
+}
+
+void					chunk_renderer::set_batching(bool state)
+{
+	get_instance()->is_batching_enabled = state;
+}
+
+void					chunk_renderer::upload_frame_uniforms()
+{
+	uniform_projection.upload(camera::get_instance()->get_projection_matrix());
+	uniform_view.upload(camera::get_instance()->get_view_matrix());
+	uniform_fog_density.upload(1.f / (world_settings::fog_limit[world_settings::current_visibility_option]));
+	uniform_apply_water_tint.upload(apply_water_tint);
+}
+
+void					chunk_renderer::render_group(group group)
+{
+	auto				&queue = queues[(int)group];
+
+	if (queue.empty())
+		return ;
+
+	uniform_alpha_discard_floor.upload(get_alpha_discard_floor(group));
+
+	for (const auto &model : queue)
+	{
+		model->use(true);
+		uniform_transformation.upload(model->get_transformation());
+		model->render();
+	}
+
+	queue.back()->use(false);
+	queue.clear();
+}
+
+void					chunk_renderer::render_group_without_batching(group group)
+{
+	auto				&queue = queues[(int)group];
+
+	for (const auto &model : queue)
+	{
+		program->use(true);
+		upload_frame_uniforms();
+		uniform_alpha_discard_floor.upload(get_alpha_discard_floor(group));
+
+		model->use(true);
+		texture_atlas::use(true);
+
+		uniform_transformation.upload(model->get_transformation());
+		model->render();
+
+		texture_atlas::use(false);
+		model->use(false);
+		program->use(false);
+	}
+
+	queue.clear();
+}
+
+float					chunk_renderer::get_alpha_discard_floor(group group)
+{
+	return group == group::partially_transparent ? 0.8f : 0.f;
 }
\ No newline at end of file
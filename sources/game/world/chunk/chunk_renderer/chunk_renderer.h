@@ -40,16 +40,38 @@ public :
 
 	static void						set_apply_water_tint(bool value);
 
-	static void						render(const shared_ptr<chunk> &chunk, group group);
+	static void						enqueue(const shared_ptr<chunk> &chunk, group group);
+	static void						enqueue(const shared_ptr<engine::model> &model, group group);
+	static void						render_queue();
+
+	// Without batching every model sets up whole state on its own, as renderer did before queues.
+	// It's kept only so benchmark can compare GL calls of both paths
+	static void						set_batching(bool state);
 
 private :
 
+	static constexpr int			number_of_groups = 3;
+
+	// Groups are flushed in this order, so opaque geometry is written to depth first.
+	// All partially transparent models go before any transparent one, instead of both groups being interleaved chunk by chunk,
+	// so water is always blended over foliage, that is behind it
+	static constexpr group			render_order[number_of_groups] =
+	{
+		group::opaque,
+		group::partially_transparent,
+		group::transparent
+	};
+
 	inline static const string		path_to_vertex_shader = "resources/shaders/chunk.vertex.glsl";
 	inline static const string		path_to_fragment_shader = "resources/shaders/chunk.fragment.glsl";
 
 	bool							apply_water_tint;
+	bool							is_batching_enabled = true;
 	unique_ptr<engine::program>		program;
 
+	array<vector<shared_ptr<engine::model>>, number_of_groups>
+									queues;
+
 	engine::uniform<mat4>			uniform_projection;
 	engine::uniform<mat4>			uniform_view;
 	engine::uniform<mat4>			uniform_transformation;
@@ -60,9 +82,10 @@ private :
 	engine::uniform<float>			uniform_fog_gradient;
 	engine::uniform<int>			uniform_apply_water_tint;
 
-	static void						render
-									(
-										const shared_ptr<engine::model> &model,
-										float alpha_discard_floor = 0.f
-									);
+	void							upload_frame_uniforms();
+
+	void							render_group(group group);
+	void							render_group_without_batching(group group);
+
+	static float					get_alpha_discard_floor(group group);
 };
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "chunk_storage.h"
+
+#include "application/common/debug/debug.h"
+
+#include "engine/launcher/launcher.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/chunk_storage/chunk_storage_settings.h"
+
+using namespace						game;
+
+template							<typename type>
+static void							write_value(ofstream &file, type value)
+{
+	file.write(reinterpret_cast<const char *>(&value), sizeof(type));
+}
+
+template							<typename type>
+static type							read_value(ifstream &file)
+{
+	type							value = {};
+
+	file.read(reinterpret_cast<char *>(&value), sizeof(type));
+	return value;
+}
+
+bool								chunk_storage::is_enabled()
+{
+	return not chunk_storage_settings::path.empty();
+}
+
+world_config						chunk_storage::open(const world_config &config)
+{
+	filesystem::create_directories(filesystem::path(chunk_storage_settings::path) / "chunks");
+	chunk_storage::config = config;
+
+	if (ifstream file(get_config_path()); file.is_open())
+	{
+		string						key;
+		string						value;
+
+		while (file >> key >> value)
+		{
+			if (key == "seed")
+			{
+				if (auto seed = engine::launcher::parse_number(value); seed)
+					chunk_storage::config.seed = *seed;
+			}
+			else if (key == "noise")
+			{
+				if (auto type = noise_backend::find_type(value); type)
+					chunk_storage::config.noise_type = *type;
+			}
+		}
+
+		debug::check
+		(
+			chunk_storage::config.seed == config.seed and chunk_storage::config.noise_type == config.noise_type,
+			"[game::chunk_storage] Stored world has different config, it's used instead of given one"
+		);
+	}
+	else
+	{
+		ofstream					output(get_config_path());
+
+		output << "seed " << config.seed << "\n";
+		output << "noise " << noise_backend::get_name(config.noise_type) << "\n";
+	}
+
+	return chunk_storage::config;
+}
+
+bool								chunk_storage::exists(const vec3 &position)
+{
+	return filesystem::exists(get_chunk_path(position));
+}
+
+bool								chunk_storage::save(const chunk &chunk, const pending_block_writes::writes_by_target &outgoing_writes)
+{
+	const auto						path = get_chunk_path(chunk.get_position());
+	auto							temporary_path = path;
+
+	temporary_path += ".tmp";
+
+	{
+		ofstream					file(temporary_path, ios::binary);
+
+		if (not debug::check(file.is_open(), "[game::chunk_storage] Can't write chunk"))
+			return false;
+
+		write_value<uint32_t>(file, magic);
+		write_value<uint32_t>(file, version);
+		write_value<int32_t>(file, config.seed);
+		write_value<int32_t>(file, (int)chunk.get_position().x);
+		write_value<int32_t>(file, (int)chunk.get_position().z);
+
+		for (int x = 0; x < chunk_settings::size[0]; x++)
+		for (int y = 0; y < chunk_settings::size[1]; y++)
+		for (int z = 0; z < chunk_settings::size[2]; z++)
+			write_value<uint8_t>(file, (uint8_t)chunk.at(x, y, z).get_type());
+
+		const auto					&surface = chunk.get_surface_map();
+
+		for (int x = 0; x < surface_map::size_x; x++)
+		for (int z = 0; z < surface_map::size_z; z++)
+		{
+			write_value<uint8_t>(file, (uint8_t)surface.get_biome_id(x, z));
+			write_value<int16_t>(file, (int16_t)surface.get_raw_height(x, z));
+			write_value<int16_t>(file, (int16_t)surface.get_interpolated_height(x, z));
+			write_value<int16_t>(file, (int16_t)surface.get_final_height(x, z));
+		}
+
+		write_value<uint32_t>(file, (uint32_t)outgoing_writes.size());
+
+		for (const auto &[target, writes] : outgoing_writes)
+		{
+			write_value<int32_t>(file, (int)target.x);
+			write_value<int32_t>(file, (int)target.z);
+			write_value<uint32_t>(file, (uint32_t)writes.size());
+
+			for (const auto &write : writes)
+			{
+				write_value<int16_t>(file, (int16_t)write.index.x);
+				write_value<int16_t>(file, (int16_t)write.index.y);
+				write_value<int16_t>(file, (int16_t)write.index.z);
+				write_value<uint8_t>(file, (uint8_t)write.type);
+			}
+		}
+
+		if (not debug::check(file.good(), "[game::chunk_storage] Can't write chunk"))
+			return false;
+	}
+
+	filesystem::rename(temporary_path, path);
+	return true;
+}
+
+bool								chunk_storage::load(chunk &chunk, pending_block_writes &pending_writes)
+{
+	ifstream						file(get_chunk_path(chunk.get_position()), ios::binary);
+
+	if (not file.is_open())
+		return false;
+
+	const bool						is_header_valid =
+	(
+		read_value<uint32_t>(file) == magic and
+		read_value<uint32_t>(file) == version and
+		read_value<int32_t>(file) == config.seed and
+		read_value<int32_t>(file) == (int)chunk.get_position().x and
+		read_value<int32_t>(file) == (int)chunk.get_position().z
+	);
+
+	if (not debug::check(is_header_valid, "[game::chunk_storage] Stored chunk doesn't match world"))
+		return false;
+
+	for (int x = 0; x < chunk_settings::size[0]; x++)
+	for (int y = 0; y < chunk_settings::size[1]; y++)
+	for (int z = 0; z < chunk_settings::size[2]; z++)
+		chunk.at(x, y, z).set_type((block_type)read_value<uint8_t>(file));
+
+	auto							&surface = chunk.get_surface_map();
+
+	for (int x = 0; x < surface_map::size_x; x++)
+	for (int z = 0; z < surface_map::size_z; z++)
+	{
+		const auto					biome_id = read_value<uint8_t>(file);
+		const auto					raw_height = read_value<int16_t>(file);
+		const auto					interpolated_height = read_value<int16_t>(file);
+
+		surface.set_column(x, z, biome_id, raw_height, interpolated_height);
+		surface.set_final_height(x, z, read_value<int16_t>(file));
+	}
+
+	pending_block_writes::writes_by_target	outgoing_writes;
+	const auto						number_of_targets = read_value<uint32_t>(file);
+
+	for (uint32_t target_index = 0; target_index < number_of_targets and file.good(); target_index++)
+	{
+		const auto					target_x = read_value<int32_t>(file);
+		const auto					target_z = read_value<int32_t>(file);
+		const auto					number_of_writes = read_value<uint32_t>(file);
+
+		auto						&writes = outgoing_writes[vec3(target_x, 0, target_z)];
+
+		for (uint32_t write_index = 0; write_index < number_of_writes and file.good(); write_index++)
+		{
+			chunk::index			index;
+
+			index.x = read_value<int16_t>(file);
+			index.y = read_value<int16_t>(file);
+			index.z = read_value<int16_t>(file);
+
+			writes.push_back({index, (block_type)read_value<uint8_t>(file)});
+		}
+	}
+
+	if (not debug::check(file.good(), "[game::chunk_storage] Stored chunk is truncated"))
+		return false;
+
+	pending_writes.store(chunk.get_position(), move(outgoing_writes));
+	return true;
+}
+
+filesystem::path					chunk_storage::get_chunk_path(const vec3 &position)
+{
+	const int						x = (int)position.x / chunk_settings::size[0];
+	const int						z = (int)position.z / chunk_settings::size[2];
+
+	return filesystem::path(chunk_storage_settings::path) / "chunks" / (to_string(x) + "_" + to_string(z) + ".chunk");
+}
+
+filesystem::path					chunk_storage::get_config_path()
+{
+	return filesystem::path(chunk_storage_settings::path) / "world.txt";
+}
\ No newline at end of file
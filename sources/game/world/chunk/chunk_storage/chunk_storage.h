@@ -0,0 +1,46 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+#include "application/common/imports/glm.h"
+
+#include "game/world/world/world_config.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
+
+namespace								game
+{
+	class								chunk;
+	class								chunk_storage;
+}
+
+// Persistent storage of generated chunks. Each chunk is kept in its own file inside of world directory :
+// header (magic, version, seed, chunk coordinates), block types as bytes in order of chunk's array,
+// surface map (biome and heights of each column) and blocks, that structures of chunk place into its neighbors.
+// Light isn't stored, it's computed again after loading.
+class									game::chunk_storage
+{
+public :
+
+	static bool							is_enabled();
+
+	// Creates world directory if needed. If world already exists, its stored config is returned,
+	// so chunks, that are generated after loading, match stored ones
+	static world_config					open(const world_config &config);
+
+	static bool							exists(const vec3 &position);
+
+	// Chunk is written to temporary file, which is renamed at the end, so interrupted save never leaves broken file
+	static bool							save(const chunk &chunk, const pending_block_writes::writes_by_target &outgoing_writes);
+
+	// Outgoing writes of loaded chunk are stored into given pending writes
+	static bool							load(chunk &chunk, pending_block_writes &pending_writes);
+
+private :
+
+	static constexpr uint32_t			magic = 0x58565446;
+	static constexpr uint32_t			version = 2;
+
+	static inline world_config			config;
+
+	static filesystem::path				get_chunk_path(const vec3 &position);
+	static filesystem::path				get_config_path();
+};
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+namespace						game
+{
+	struct 						chunk_storage_settings;
+}
+
+struct							game::chunk_storage_settings
+{
+	// Directory of stored world, storage is disabled if path is empty
+	static inline string		path;
+};
\ No newline at end of file
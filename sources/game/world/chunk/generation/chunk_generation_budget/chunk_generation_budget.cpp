@@ -0,0 +1,64 @@
+#include "chunk_generation_budget.h"
+
+#include "engine/main/system/profiler/profiler/profiler.h"
+
+using namespace				game;
+
+void						chunk_generation_budget::update()
+{
+	using					settings = chunk_generation_budget_settings;
+
+	static const int		budget_section = engine::profiler::register_section
+	(
+		"Generation budget",
+		engine::profiler::section_type::value
+	);
+
+	const int				number_of_frames = engine::profiler::get_number_of_recorded_frames();
+
+	if (is_warm_up)
+		budget = settings::warm_up_budget;
+	else if (number_of_frames > 0)
+	{
+		const float			frame_time = engine::profiler::get_frame_time(number_of_frames - 1);
+
+		if (frame_time > settings::target_frame_time * (1.f + settings::tolerance))
+			budget *= settings::shrink_factor;
+		else
+			budget += settings::growth_step;
+
+		budget = clamp(budget, settings::min_budget, settings::max_budget);
+	}
+
+	engine::profiler::register_value(budget_section, budget);
+}
+
+void						chunk_generation_budget::set_warm_up(bool state)
+{
+	is_warm_up = state;
+
+	if (not state)
+		budget = chunk_generation_budget_settings::max_budget;
+}
+
+float						chunk_generation_budget::get_budget()
+{
+	return budget;
+}
+
+void						chunk_generation_budget::register_backlog(int value)
+{
+	static const int		backlog_section = engine::profiler::register_section
+	(
+		"Generation backlog",
+		engine::profiler::section_type::value
+	);
+
+	backlog = value;
+	engine::profiler::register_value(backlog_section, (float)value);
+}
+
+int							chunk_generation_budget::get_backlog()
+{
+	return backlog;
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+#include "game/world/chunk/generation/chunk_generation_budget/chunk_generation_budget_settings.h"
+
+namespace					game
+{
+	class					chunk_generation_budget;
+}
+
+// Time the main thread may spend on chunk generation, scheduling and uploads during one frame.
+// It's adjusted every frame by comparing the last frame time with the target one.
+class						game::chunk_generation_budget
+{
+public :
+
+							chunk_generation_budget() = delete;
+
+	static void				update();
+
+	// While warm-up is active, budget is fixed to warm-up budget instead of being adjusted
+	static void				set_warm_up(bool state);
+
+	static float			get_budget();
+
+	// Number of chunks that weren't processed because budget was exhausted
+	static void				register_backlog(int value);
+	static int				get_backlog();
+
+private :
+
+	static inline float		budget = chunk_generation_budget_settings::initial_budget;
+	static inline int		backlog = 0;
+	static inline bool		is_warm_up = false;
+};
\ No newline at end of file
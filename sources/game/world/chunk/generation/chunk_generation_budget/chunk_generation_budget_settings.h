@@ -0,0 +1,28 @@
+#pragma once
+
+namespace					game
+{
+	struct					chunk_generation_budget_settings;
+}
+
+struct						game::chunk_generation_budget_settings
+{
+	static inline float		target_frame_time = 1.f / 60.f;
+
+	// Frames slower than target by less than this fraction are still considered on time
+	static inline float		tolerance = 0.05f;
+
+	static inline float		initial_budget = 1.f / 120.f;
+	static inline float		min_budget = 0.001f;
+	static inline float		max_budget = 0.012f;
+
+	// Budget grows slowly and shrinks fast, so spikes are resolved within a couple of frames
+	static inline float		growth_step = 0.00025f;
+	static inline float		shrink_factor = 0.75f;
+
+	// Player has no control during warm-up, so frames may be long and most of them is given to generation
+	static inline float		warm_up_budget = 0.05f;
+
+	// Rebuild after block edit should be visible in same frame, so it isn't limited by adaptive budget
+	static inline float		forced_build_limit = 10.f / 60.f;
+};
\ No newline at end of file
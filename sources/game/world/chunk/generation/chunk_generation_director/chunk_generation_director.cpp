@@ -1,8 +1,10 @@
 #include "chunk_generation_director.h"
 
-#include "application/common/utilities/type_utility.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/profiler/scoped_timer/scoped_timer.h"
 
 #include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
 #include "game/world/world/world.h"
 
 using namespace					game;
@@ -19,7 +21,12 @@ optional<chunk_build>			chunk_generation_director::process_build(const shared_pt
 	if (instance->get_state() == state::deinitialized)
 		return nullopt;
 
-	return find_or_create_worker(chunk).process();
+	auto						build = find_or_create_worker(chunk).process();
+
+	if (build)
+		instance->number_of_finished_builds++;
+
+	return build;
 }
 
 void							chunk_generation_director::reset_build(const shared_ptr<chunk> &chunk)
@@ -36,6 +43,7 @@ void							chunk_generation_director::reset_build(const shared_ptr<chunk> &chunk
 	);
 
 	const auto					&old_worker = find_worker(chunk);
+	const bool					should_apply_pending_writes = not old_worker.did_apply_pending_writes();
 
 	debug::check
 	(
@@ -45,9 +53,8 @@ void							chunk_generation_director::reset_build(const shared_ptr<chunk> &chunk
 
 	instance->drop_worker(chunk);
 
-	auto						&new_worker = instance->find_or_create_worker(chunk, is_landscape_and_decorations_generated);
+	auto						&new_worker = instance->find_or_create_worker(chunk, is_landscape_and_decorations_generated, should_apply_pending_writes);
 
-	old_worker.share_workspace(new_worker);
 	new_worker.process(true);
 }
 
@@ -57,6 +64,9 @@ void 							chunk_generation_director::delete_build(const shared_ptr<chunk> &chu
 		return;
 
 	get_instance()->drop_worker(chunk);
+
+	// If chunk is created again, it will be decorated again and store same writes
+	get_instance()->pending_writes.discard(chunk->get_position());
 }
 
 bool							chunk_generation_director::have_worker(const shared_ptr<chunk> &chunk)
@@ -74,17 +84,31 @@ chunk_generation_worker			&chunk_generation_director::find_worker(const shared_p
 chunk_generation_worker			&chunk_generation_director::find_or_create_worker
 								(
 									const shared_ptr<chunk> &chunk,
-									bool preserve_landscape_and_decorations
+									bool preserve_landscape_and_decorations,
+									bool apply_pending_writes
 								)
 {
 	const auto 					instance = get_instance();
 
 	if (instance->active_workers.find(chunk) == instance->active_workers.end())
-		instance->active_workers.emplace(chunk, make_unique<chunk_generation_worker>(chunk, not preserve_landscape_and_decorations));
+		instance->active_workers.emplace(chunk, make_unique<chunk_generation_worker>(chunk, not preserve_landscape_and_decorations, apply_pending_writes));
 
 	return *instance->active_workers.at(chunk);
 }
 
+void							chunk_generation_director::register_completed_task(chunk_generation_task *task)
+{
+	get_instance()->completed_tasks.push(task);
+}
+
+void							chunk_generation_director::process_completed_tasks()
+{
+	const auto 					instance = get_instance();
+
+	while (auto task = instance->completed_tasks.pop())
+		(*task)->complete();
+}
+
 void 							chunk_generation_director::when_deinitialized()
 {
 #if FT_VOX_FORCE_EXIT
@@ -98,8 +122,33 @@ void 							chunk_generation_director::when_deinitialized()
 		worker->wait_for_finish_of_task();
 }
 
+int								chunk_generation_director::get_number_of_finished_builds()
+{
+	return get_instance()->number_of_finished_builds;
+}
+
+int								chunk_generation_director::get_number_of_dropped_workers()
+{
+	return (int)get_instance()->dropped_workers.size();
+}
+
+bool							chunk_generation_director::has_completed_tasks()
+{
+	return not get_instance()->completed_tasks.is_empty();
+}
+
+pending_block_writes			&chunk_generation_director::get_pending_writes()
+{
+	return get_instance()->pending_writes;
+}
+
 void 							chunk_generation_director::when_updated()
 {
+	static const int			section = engine::profiler::register_section("Generation director");
+	engine::scoped_timer		profiling_timer(section);
+
+	process_completed_tasks();
+
 	for (auto iterator = dropped_workers.begin(); iterator != dropped_workers.end();)
 	{
 		if (not (*iterator)->is_busy())
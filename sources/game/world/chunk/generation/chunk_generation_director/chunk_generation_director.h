@@ -1,16 +1,19 @@
 #pragma once
 
 #include "application/common/templates/singleton/singleton.h"
+#include "application/common/templates/mpsc_queue/mpsc_queue.h"
 
 #include "engine/main/core/object/object/object.h"
 #include "engine/main/core/object/object_constructor/unique_object_constructor/unique_object_constructor.h"
 
 #include "game/world/chunk/generation/chunk_generation_worker/chunk_generation_worker.h"
 #include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
 
 namespace									game
 {
 	class									chunk_build;
+	class									chunk_generation_task;
 	class									chunk_generation_director;
 }
 
@@ -36,14 +39,35 @@ public :
 	static chunk_generation_worker			&find_or_create_worker
 											(
 												const shared_ptr<chunk> &chunk,
-												bool preserve_landscape_and_decorations = false
+												bool preserve_landscape_and_decorations = false,
+												bool apply_pending_writes = true
 											);
 
+	// Can be called from any thread
+	static void								register_completed_task(chunk_generation_task *task);
+	static void								process_completed_tasks();
+
+	static int								get_number_of_finished_builds();
+
+	// Workers of destroyed chunks, that still wait for their tasks to finish
+	static int								get_number_of_dropped_workers();
+
+	// Main thread only, true if some finished tasks weren't reported to their workers yet
+	static bool								has_completed_tasks();
+
+	// Blocks of structures, that decorations of chunks place into their neighbors
+	static pending_block_writes				&get_pending_writes();
+
 private :
 
 	workers_map								active_workers;
 	workers_list							dropped_workers;
 
+	mpsc_queue<chunk_generation_task *>		completed_tasks;
+	pending_block_writes					pending_writes;
+
+	int										number_of_finished_builds = 0;
+
 	void 									when_deinitialized() override;
 	void 									when_updated() override;
 
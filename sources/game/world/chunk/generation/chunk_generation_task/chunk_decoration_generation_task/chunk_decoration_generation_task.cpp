@@ -1,41 +1,48 @@
 #include "chunk_decoration_generation_task.h"
 
 #include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
-#include "game/world/chunk/generation/utilities/height_interpolator/height_interpolator.h"
+#include "game/world/chunk/generation/utilities/biome/biomes/abstract/abstract.h"
+#include "game/world/chunk/generation/utilities/structure_writer/structure_writer.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
 
 using namespace			game;
 
-						chunk_decoration_generation_task::chunk_decoration_generation_task() : chunk_generation_task(true)
+						chunk_decoration_generation_task::chunk_decoration_generation_task(pending_block_writes &pending_writes) :
+							chunk_generation_task(true),
+							pending_writes(pending_writes)
 {}
 
 void 					chunk_decoration_generation_task::do_launch(chunk_workspace &workspace)
 {
-	generate_decoration_on_chunk(workspace);
+	structure_writer	writer(workspace.chunk);
+
+	generate_decoration_on_chunk(workspace, writer);
+	pending_writes.store(workspace.chunk->get_position(), writer.take_pending_writes());
 }
 
-void 					chunk_decoration_generation_task::generate_decoration_on_chunk(chunk_workspace &workspace)
+void 					chunk_decoration_generation_task::generate_decoration_on_chunk(chunk_workspace &workspace, structure_writer &writer)
 {
 	chunk::index		index;
 
 	for (index.x = 0; index.x < chunk_settings::size[0]; index.x++)
 	for (index.z = 0; index.z < chunk_settings::size[2]; index.z++)
 	{
-		generate_decoration_on_column(workspace, index);
+		generate_decoration_on_column(workspace, writer, index);
 	}
 }
 
 void					chunk_decoration_generation_task::generate_decoration_on_column
 						(
 							chunk_workspace &workspace,
+							structure_writer &writer,
 	   						chunk::index index
 	   					)
 {
 	const auto			&chunk = workspace.chunk;
-	const auto 			column = vec2(chunk->get_position().x + (float)index.x, chunk->get_position().z + (float)index.z);
-	const auto			column_info = workspace.column_infos.at({index.x, 0, index.z});
+	const auto			&surface = chunk->get_surface_map();
 
-	const auto			biome = column_info.biome;
-	const auto			block = block_ptr(chunk, {index.x, column_info.final_height + 1, index.z});
+	const auto			biome = surface.get_biome(index.x, index.z);
+	const auto			block = block_ptr(chunk, {index.x, surface.get_final_height(index.x, index.z) + 1, index.z});
 
-	biome->generate_decoration(block, column_info.is_height_affected_by_cave);
+	biome->generate_decoration(block, surface.is_height_affected_by_cave(index.x, index.z), writer);
 }
\ No newline at end of file
@@ -4,20 +4,26 @@
 #include "game/world/chunk/chunk/chunk.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
 
-namespace			game
+namespace					game
 {
-	class			chunk_decoration_generation_task;
+	class					structure_writer;
+	class					pending_block_writes;
+	class					chunk_decoration_generation_task;
 }
 
-class				game::chunk_decoration_generation_task : public game::chunk_generation_task
+// Decorates only its own chunk, blocks of structures, that cross chunk border, are passed to pending block writes.
+// So task can be launched as soon as landscape of chunk is ready, without waiting for neighbors.
+class						game::chunk_decoration_generation_task : public game::chunk_generation_task
 {
 public :
-					chunk_decoration_generation_task();
-					~chunk_decoration_generation_task() override = default;
+	explicit				chunk_decoration_generation_task(pending_block_writes &pending_writes);
+							~chunk_decoration_generation_task() override = default;
 protected :
 
-	void 			do_launch(chunk_workspace &workspace) override;
+	pending_block_writes	&pending_writes;
 
-	static void		generate_decoration_on_chunk(chunk_workspace &workspace);
-	static void		generate_decoration_on_column(chunk_workspace &workspace, chunk::index index);
+	void 					do_launch(chunk_workspace &workspace) override;
+
+	static void				generate_decoration_on_chunk(chunk_workspace &workspace, structure_writer &writer);
+	static void				generate_decoration_on_column(chunk_workspace &workspace, structure_writer &writer, chunk::index index);
 };
\ No newline at end of file
@@ -2,8 +2,7 @@
 
 #include "application/common/debug/debug.h"
 
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_launched.h"
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_done.h"
+#include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
 
 using namespace				game;
 
@@ -19,6 +18,11 @@ state						chunk_generation_task::get_state() const
 	return state;
 }
 
+engine::clock::ticks		chunk_generation_task::get_launch_time() const
+{
+	return launch_time;
+}
+
 void 						chunk_generation_task::launch(chunk_workspace &workspace)
 {
 #if FT_VOX_DEBUG
@@ -26,30 +30,47 @@ void 						chunk_generation_task::launch(chunk_workspace &workspace)
 #endif
 
 	state = launched;
+	notify(chunk_generation_task_launched());
 
 	if (is_async)
 	{
+		// Generation thread only reports completion, state of task and worker is changed later on main thread
 		future = async
 		(
 			launch::async,
 			[this, &workspace]()
 			{
-				notify(chunk_generation_task_launched());
-				do_launch(workspace);
-				state = done;
-				notify(chunk_generation_task_done());
+				measure_launch(workspace);
+				chunk_generation_director::register_completed_task(this);
 			}
 		);
 	}
 	else
 	{
-		notify(chunk_generation_task_launched());
-		do_launch(workspace);
-		state = done;
-		notify(chunk_generation_task_done());
+		measure_launch(workspace);
+		complete();
 	}
 }
 
+void						chunk_generation_task::complete()
+{
+	state = done;
+	notify(chunk_generation_task_done());
+}
+
+void						chunk_generation_task::measure_launch(chunk_workspace &workspace)
+{
+	const auto				start = engine::clock::now();
+
+	do_launch(workspace);
+	launch_time = engine::clock::now() - start;
+}
+
+void						chunk_generation_task::execute(chunk_workspace &workspace)
+{
+	measure_launch(workspace);
+}
+
 void 						chunk_generation_task::wait()
 {
 	if (future)
@@ -3,7 +3,10 @@
 #include "application/common/imports/std.h"
 #include "application/common/templates/notifier_and_listener/notifier.h"
 
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_notification.h"
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_launched.h"
+#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_done.h"
 
 namespace					game
 {
@@ -11,7 +14,7 @@ namespace					game
 	class					chunk_generation_task;
 }
 
-class						game::chunk_generation_task : public notifier<game::chunk_generation_task_notification>
+class						game::chunk_generation_task : public notifier<game::chunk_generation_task_launched, game::chunk_generation_task_done>
 {
 public :
 
@@ -27,9 +30,19 @@ public :
 
 	state					get_state() const;
 
+	// Time spent in do_launch, valid after task is done
+	engine::clock::ticks	get_launch_time() const;
+
 	void 					launch(chunk_workspace &workspace);
 	void 					wait();
 
+	// Runs task on calling thread without changing its state or notifying anyone.
+	// Used when chunks are generated outside of streaming, so there is no worker to report to.
+	void					execute(chunk_workspace &workspace);
+
+	// Should be called only from main thread, after task was reported to director as completed
+	void					complete();
+
 protected :
 
 	explicit				chunk_generation_task(bool is_async);
@@ -40,6 +53,10 @@ private :
 	const bool 				is_async;
 	enum state				state;
 	optional<future<void>>	future;
+
+	engine::clock::ticks	launch_time = 0;
+
+	void					measure_launch(chunk_workspace &workspace);
 };
 
 
@@ -9,6 +9,7 @@
 #include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/tools/vector_tools/vector_tools.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/tools/ao_calculator/ao_calculator.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/tools/light_mixer/light_mixer.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/tools/connectivity_calculator/connectivity_calculator.h"
 
 using namespace		game;
 
@@ -19,6 +20,7 @@ void 				chunk_geometry_generation_task::do_launch(chunk_workspace &workspace)
 {
 	filter_blocks_and_save_to_batches(workspace);
 	launch_batches_processing(workspace);
+	calculate_connectivity(workspace);
 }
 
 void				chunk_geometry_generation_task::filter_blocks_and_save_to_batches(chunk_workspace &workspace)
@@ -46,6 +48,8 @@ void 				chunk_geometry_generation_task::launch_batches_processing(chunk_workspa
 	process_batch(workspace.batch_for_opaque);
 	process_batch(workspace.batch_for_transparent);
 	process_batch(workspace.batch_for_partially_transparent);
+
+	calculate_quad_centers(workspace.batch_for_transparent);
 }
 
 void				chunk_geometry_generation_task::process_batch(chunk_workspace::batch &batch)
@@ -179,50 +183,17 @@ void				chunk_geometry_generation_task::generate_vertices(chunk_workspace::batch
 
 void				chunk_geometry_generation_task::generate_texture_coordinates(chunk_workspace::batch &batch, const block_ptr &block, block_face face)
 {
-	static const
-	auto			transform_texture_coordinate = [](const ivec2 &texture_coordinates, float &x, float &y)
-	{
-		static const
-		vec2		size = texture_atlas::get_texture_size();
-
-		x = size.x * ((float)texture_coordinates.x + x);
-		y = size.y * ((float)texture_coordinates.y + y);
-	};
+	// Atlas is frozen before generation starts, so this is a plain read without locks
+	const auto		&rectangle = texture_atlas::get_rectangle(block->get_type(), face);
 
-	auto					texture_coordinates = ivec2(0);
-
-	switch (face)
+	for (int i = (int)batch.texture_coordinates.size() - 8; i < (int)batch.texture_coordinates.size(); i += 2)
 	{
-		case block_face::right:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_right();
-			break;
-
-		case block_face::left:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_left();
-			break;
+		auto		&x = batch.texture_coordinates[i + 0];
+		auto		&y = batch.texture_coordinates[i + 1];
 
-		case block_face::top:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_top();
-			break;
-
-		case block_face::bottom:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_bottom();
-			break;
-
-		case block_face::front:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_front();
-			break;
-
-		case block_face::back:
-			texture_coordinates = texture_atlas::get_coordinates(block->get_type()).get_back();
-			break;
-
-		default :
-			debug::raise_error("[game::chunk_geometry_builder] Can't generate texture coordinates");
+		x = mix(rectangle.min.x, rectangle.max.x, x);
+		y = mix(rectangle.min.y, rectangle.max.y, y);
 	}
-
-	for (int i = (int)batch.texture_coordinates.size() - 8; i < (int)batch.texture_coordinates.size(); i += 2)
-		transform_texture_coordinate(texture_coordinates, batch.texture_coordinates[i + 0], batch.texture_coordinates[i + 1]);
 }
 
 void 				chunk_geometry_generation_task::generate_light_levels(chunk_workspace::batch &batch, const block_ptr &block, block_face face, float light_level)
@@ -231,4 +202,25 @@ void 				chunk_geometry_generation_task::generate_light_levels(chunk_workspace::
 
 	for (float &ao : ao_calculator::calculate(block, face))
 		batch.light_levels.push_back(light_mixer::mix_light_and_ao(light_level, ao));
+}
+
+void				chunk_geometry_generation_task::calculate_quad_centers(chunk_workspace::batch &batch)
+{
+	batch.quad_centers.reserve(batch.vertices.size() / 12);
+
+	for (int i = 0; i < (int)batch.vertices.size(); i += 12)
+	{
+		batch.quad_centers.emplace_back
+		(
+			(batch.vertices[i + 0] + batch.vertices[i + 3] + batch.vertices[i + 6] + batch.vertices[i + 9]) / 4.f,
+			(batch.vertices[i + 1] + batch.vertices[i + 4] + batch.vertices[i + 7] + batch.vertices[i + 10]) / 4.f,
+			(batch.vertices[i + 2] + batch.vertices[i + 5] + batch.vertices[i + 8] + batch.vertices[i + 11]) / 4.f
+		);
+	}
+}
+
+void				chunk_geometry_generation_task::calculate_connectivity(chunk_workspace &workspace)
+{
+	for (int section = 0; section < chunk_settings::number_of_sections; section++)
+		workspace.connectivity[section] = connectivity_calculator::calculate(*workspace.chunk, section);
 }
\ No newline at end of file
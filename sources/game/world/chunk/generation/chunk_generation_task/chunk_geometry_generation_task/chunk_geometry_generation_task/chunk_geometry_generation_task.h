@@ -34,4 +34,7 @@ private :
 	static void		generate_vertices(chunk_workspace::batch &batch, const block_ptr &block, block_face face);
 	static void		generate_texture_coordinates(chunk_workspace::batch &batch, const block_ptr &block, block_face face);
 	static void		generate_light_levels(chunk_workspace::batch &batch, const block_ptr &block, block_face face, float light_level);
+
+	static void		calculate_quad_centers(chunk_workspace::batch &batch);
+	static void		calculate_connectivity(chunk_workspace &workspace);
 };
\ No newline at end of file
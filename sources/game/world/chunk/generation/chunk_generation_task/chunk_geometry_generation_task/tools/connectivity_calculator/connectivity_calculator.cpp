@@ -0,0 +1,108 @@
+#include "connectivity_calculator.h"
+
+using namespace					game;
+
+section_connectivity			connectivity_calculator::calculate(const chunk &chunk, int section)
+{
+	const int					min_y = section * chunk_settings::section_height;
+
+	section_connectivity		connectivity;
+	vector<bool>				visited(chunk_settings::size[0] * chunk_settings::section_height * chunk_settings::size[2]);
+	ivec3						index;
+
+	for (index.x = 0; index.x < chunk_settings::size[0]; index.x++)
+	for (index.y = min_y; index.y < min_y + chunk_settings::section_height; index.y++)
+	for (index.z = 0; index.z < chunk_settings::size[2]; index.z++)
+	{
+		if (visited[to_visited_index(index, min_y)] or not is_passable(chunk, index))
+			continue ;
+
+		flood_fill(chunk, index, min_y, visited, connectivity);
+	}
+
+	return connectivity;
+}
+
+void							connectivity_calculator::flood_fill
+								(
+									const chunk &chunk,
+									const ivec3 &start,
+									int min_y,
+									vector<bool> &visited,
+									section_connectivity &connectivity
+								)
+{
+	static const ivec3			offsets[6] =
+	{
+		ivec3(-1, 0, 0),
+		ivec3(+1, 0, 0),
+		ivec3(0, 0, +1),
+		ivec3(0, 0, -1),
+		ivec3(0, +1, 0),
+		ivec3(0, -1, 0)
+	};
+
+	const int					max_y = min_y + chunk_settings::section_height;
+
+	vector<ivec3>				stack = {start};
+	vector<block_face>			touched_faces;
+
+	const auto					touch = [&touched_faces](block_face face)
+	{
+		if (find(touched_faces.begin(), touched_faces.end(), face) == touched_faces.end())
+			touched_faces.push_back(face);
+	};
+
+	visited[to_visited_index(start, min_y)] = true;
+
+	while (not stack.empty())
+	{
+		const auto				current = stack.back();
+
+		stack.pop_back();
+
+		if (current.x == 0)
+			touch(block_face::left);
+		if (current.x == chunk_settings::size[0] - 1)
+			touch(block_face::right);
+		if (current.z == chunk_settings::size[2] - 1)
+			touch(block_face::front);
+		if (current.z == 0)
+			touch(block_face::back);
+		if (current.y == max_y - 1)
+			touch(block_face::top);
+		if (current.y == min_y)
+			touch(block_face::bottom);
+
+		for (const auto &offset : offsets)
+		{
+			const auto			neighbor = current + offset;
+
+			if (neighbor.x < 0 or neighbor.x >= chunk_settings::size[0])
+				continue ;
+			if (neighbor.y < min_y or neighbor.y >= max_y)
+				continue ;
+			if (neighbor.z < 0 or neighbor.z >= chunk_settings::size[2])
+				continue ;
+			if (visited[to_visited_index(neighbor, min_y)] or not is_passable(chunk, neighbor))
+				continue ;
+
+			visited[to_visited_index(neighbor, min_y)] = true;
+			stack.push_back(neighbor);
+		}
+	}
+
+	for (auto first : touched_faces)
+	for (auto second : touched_faces)
+		connectivity.connect(first, second);
+}
+
+bool							connectivity_calculator::is_passable(const chunk &chunk, const ivec3 &index)
+{
+	return not is_opaque(get_meta_type(chunk.at(index.x, index.y, index.z).get_type()));
+}
+
+int								connectivity_calculator::to_visited_index(const ivec3 &index, int min_y)
+{
+	return (index.x * chunk_settings::section_height + (index.y - min_y)) * chunk_settings::size[2] + index.z;
+}
\ No newline at end of file
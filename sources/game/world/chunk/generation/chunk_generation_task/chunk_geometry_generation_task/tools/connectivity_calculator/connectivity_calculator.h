@@ -0,0 +1,30 @@
+#pragma once
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/section_connectivity/section_connectivity.h"
+
+namespace						game
+{
+	class						connectivity_calculator;
+}
+
+class							game::connectivity_calculator
+{
+public :
+
+	static section_connectivity	calculate(const chunk &chunk, int section);
+
+private :
+
+	static void					flood_fill
+								(
+									const chunk &chunk,
+									const ivec3 &start,
+									int min_y,
+									vector<bool> &visited,
+									section_connectivity &connectivity
+								);
+
+	static bool					is_passable(const chunk &chunk, const ivec3 &index);
+	static int					to_visited_index(const ivec3 &index, int min_y);
+};
\ No newline at end of file
@@ -1,12 +1,13 @@
 #include "chunk_landscape_generation_task.h"
 
 #include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
-#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
-#include "game/world/chunk/generation/utilities/height_interpolator/height_interpolator.h"
 
 using namespace			game;
 
-						chunk_landscape_generation_task::chunk_landscape_generation_task() : chunk_generation_task(true)
+						chunk_landscape_generation_task::chunk_landscape_generation_task(const world_config &config) :
+							chunk_generation_task(true),
+							cave_generator(config),
+							cloud_generator(config)
 {}
 
 void 					chunk_landscape_generation_task::do_launch(chunk_workspace &workspace)
@@ -27,23 +28,18 @@ void 					chunk_landscape_generation_task::generate_chunk(chunk_workspace &works
 
 void					chunk_landscape_generation_task::generate_column(chunk_workspace &workspace, chunk::index index)
 {
-	static const auto	height_generator = [](const vec2 &position)
-	{
-		return biome_generator::generate_biome(position)->generate_height(position);
-	};
-
 	const auto			&chunk = workspace.chunk;
-	const auto 			column = vec2(chunk->get_position().x + (float)index.x, chunk->get_position().z + (float)index.z);
+	auto				&surface = chunk->get_surface_map();
 
-	const auto			biome = biome_generator::generate_biome(column);
-	const auto			interpolated_height = height_interpolator(height_generator)(column);
+	const auto			biome = surface.get_biome(index.x, index.z);
+	const auto			interpolated_height = surface.get_interpolated_height(index.x, index.z);
 
 	optional<int>		final_height;
 	bool 				is_cave;
 	bool 				is_cloud;
 	block_type			block_type;
 
-	for (index.y = chunk_settings::size[1]; index.y >= 0; index.y--)
+	for (index.y = chunk_settings::size[1] - 1; index.y >= 0; index.y--)
 	{
 		is_cave = cave_generator(chunk->get_position() + (vec3)index);
 		is_cloud = cloud_generator(chunk->get_position() + (vec3)index);
@@ -63,31 +59,5 @@ void					chunk_landscape_generation_task::generate_column(chunk_workspace &works
 		chunk->at(index).set_type(block_type);
 	}
 
-	if (not final_height.has_value())
-		final_height = 0;
-
-	save_calculated_info
-	(
-		workspace,
-		index,
-		biome,
-		*final_height,
-		*final_height != interpolated_height
-	);
-}
-
-void					chunk_landscape_generation_task::save_calculated_info
-						(
-							chunk_workspace &workspace,
-							chunk::index index,
-							const shared_ptr<biomes::abstract> &biome,
-							int final_height,
-							int is_height_affected_by_cave
-						)
-{
-	auto				&column_info = workspace.column_infos.at({index.x, 0, index.z});
-
-	column_info.biome = biome;
-	column_info.final_height = final_height;
-	column_info.is_height_affected_by_cave = is_height_affected_by_cave;
+	surface.set_final_height(index.x, index.z, final_height.value_or(0));
 }
\ No newline at end of file
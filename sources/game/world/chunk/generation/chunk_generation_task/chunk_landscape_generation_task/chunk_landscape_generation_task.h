@@ -6,6 +6,7 @@
 #include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
 #include "game/world/chunk/generation/utilities/cave_generator/cave_generator.h"
 #include "game/world/chunk/generation/utilities/cloud_generator/cloud_generator.h"
+#include "game/world/world/world_config.h"
 
 namespace							game
 {
@@ -15,24 +16,16 @@ namespace							game
 class								game::chunk_landscape_generation_task : public game::chunk_generation_task
 {
 public :
-									chunk_landscape_generation_task();
+	explicit						chunk_landscape_generation_task(const world_config &config);
 									~chunk_landscape_generation_task() override = default;
 protected :
 
-	static inline cave_generator	cave_generator;
-	static inline cloud_generator	cloud_generator;
+	// Generators are created with each task, so they use seed and noise backend of current world
+	cave_generator					cave_generator;
+	cloud_generator					cloud_generator;
 
 	void 							do_launch(chunk_workspace &workspace) override;
 
-	static void						generate_chunk(chunk_workspace &workspace);
-	static void						generate_column(chunk_workspace &workspace, chunk::index index);
-
-	static void						save_calculated_info
-									(
-										chunk_workspace &workspace,
-										chunk::index index,
-										const shared_ptr<biomes::abstract> &biome,
-										int final_height,
-										int is_height_affected_by_cave
-									);
+	void							generate_chunk(chunk_workspace &workspace);
+	void							generate_column(chunk_workspace &workspace, chunk::index index);
 };
\ No newline at end of file
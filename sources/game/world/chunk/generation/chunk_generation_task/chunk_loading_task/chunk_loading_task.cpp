@@ -0,0 +1,33 @@
+#include "chunk_loading_task.h"
+
+#include "application/common/debug/debug.h"
+
+#include "game/world/chunk/chunk_storage/chunk_storage.h"
+#include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_surface_generation_task/chunk_surface_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_landscape_generation_task/chunk_landscape_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_decoration_generation_task/chunk_decoration_generation_task.h"
+
+using namespace						game;
+
+									chunk_loading_task::chunk_loading_task(const world_config &config, pending_block_writes &pending_writes) :
+										chunk_generation_task(true),
+										config(config),
+										pending_writes(pending_writes)
+{}
+
+void 								chunk_loading_task::do_launch(chunk_workspace &workspace)
+{
+	if (chunk_storage::load(*workspace.chunk, pending_writes))
+		return;
+
+	debug::raise_warning("[game::chunk_loading_task] Can't load chunk, it will be generated");
+
+	chunk_surface_generation_task		surface_task;
+	chunk_landscape_generation_task		landscape_task(config);
+	chunk_decoration_generation_task	decoration_task(pending_writes);
+
+	surface_task.execute(workspace);
+	landscape_task.execute(workspace);
+	decoration_task.execute(workspace);
+}
\ No newline at end of file
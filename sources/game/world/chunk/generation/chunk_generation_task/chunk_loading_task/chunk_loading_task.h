@@ -0,0 +1,25 @@
+#pragma once
+
+#include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
+#include "game/world/world/world_config.h"
+
+namespace					game
+{
+	class					pending_block_writes;
+	class					chunk_loading_task;
+}
+
+// Loads chunk from storage, replacing surface, landscape and decoration stages.
+// If stored chunk can't be read, these stages are executed right here, so worker continues in the same way.
+class						game::chunk_loading_task : public game::chunk_generation_task
+{
+public :
+							chunk_loading_task(const world_config &config, pending_block_writes &pending_writes);
+							~chunk_loading_task() override = default;
+protected :
+
+	const world_config		config;
+	pending_block_writes	&pending_writes;
+
+	void 					do_launch(chunk_workspace &workspace) override;
+};
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "chunk_surface_generation_task.h"
+
+#include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/utilities/height_interpolator/height_interpolator.h"
+
+using namespace			game;
+
+						chunk_surface_generation_task::chunk_surface_generation_task() : chunk_generation_task(true)
+{}
+
+void 					chunk_surface_generation_task::do_launch(chunk_workspace &workspace)
+{
+	generate_surface(workspace);
+}
+
+void 					chunk_surface_generation_task::generate_surface(chunk_workspace &workspace)
+{
+	static constexpr int	radius = height_interpolator::radius;
+	static constexpr int	padded_size_x = surface_map::size_x + 2 * radius;
+	static constexpr int	padded_size_z = surface_map::size_z + 2 * radius;
+
+	const auto			&chunk = workspace.chunk;
+	auto				&surface = chunk->get_surface_map();
+
+	array<int, padded_size_x * padded_size_z>
+						biome_ids;
+	array<int, padded_size_x * padded_size_z>
+						raw_heights;
+
+	for (int x = 0; x < padded_size_x; x++)
+	for (int z = 0; z < padded_size_z; z++)
+	{
+		const auto		column = vec2(chunk->get_position().x + (float)(x - radius), chunk->get_position().z + (float)(z - radius));
+		const int		biome_id = biome_generator::generate_biome_id(column);
+
+		biome_ids[x * padded_size_z + z] = biome_id;
+		raw_heights[x * padded_size_z + z] = biome_generator::get_biome(biome_id)->generate_height(column);
+	}
+
+	for (int x = 0; x < surface_map::size_x; x++)
+	for (int z = 0; z < surface_map::size_z; z++)
+	{
+		const int		center = (x + radius) * padded_size_z + (z + radius);
+
+		const int		interpolated_height = height_interpolator::interpolate([&raw_heights, center](int offset_x, int offset_z)
+		{
+			return raw_heights[center + offset_x * padded_size_z + offset_z];
+		});
+
+		surface.set_column(x, z, biome_ids[center], raw_heights[center], interpolated_height);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
+
+namespace			game
+{
+	class			chunk_surface_generation_task;
+}
+
+// Fills surface map of chunk with biome and heights, later stages only read it.
+// Biome and raw height are generated once per column of chunk extended by interpolation radius,
+// so interpolation doesn't evaluate noise for each of its samples again.
+class				game::chunk_surface_generation_task : public game::chunk_generation_task
+{
+public :
+					chunk_surface_generation_task();
+					~chunk_surface_generation_task() override = default;
+protected :
+
+	void 			do_launch(chunk_workspace &workspace) override;
+
+	static void		generate_surface(chunk_workspace &workspace);
+};
\ No newline at end of file
@@ -2,10 +2,5 @@
 
 namespace				game
 {
-	struct 				chunk_generation_task_notification
-	{
-	private :
-
-		virtual void	dummy() {}
-	};
+	struct 				chunk_generation_task_notification {};
 }
\ No newline at end of file
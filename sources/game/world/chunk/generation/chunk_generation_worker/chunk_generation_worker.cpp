@@ -1,19 +1,21 @@
 #include "chunk_generation_worker.h"
 
-#include "application/common/utilities/type_utility.h"
-
 #include "engine/main/system/time/timer/timer.h"
 
 #include "game/world/chunk/generation/utilities/chunk_workspace/chunk_workspace.h"
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_launched.h"
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_done.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_surface_generation_task/chunk_surface_generation_task.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_landscape_generation_task/chunk_landscape_generation_task.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_decoration_generation_task/chunk_decoration_generation_task.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_light_generation_task/chunk_light_generation_task.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_geometry_generation_task/chunk_geometry_generation_task/chunk_geometry_generation_task.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_model_generation_task/chunk_model_generation_task.h"
+#include "game/world/chunk/generation/chunk_generation_task/chunk_loading_task/chunk_loading_task.h"
+#include "game/world/chunk/chunk_storage/chunk_storage.h"
 #include "game/world/chunk/generation/chunk_generation_director/chunk_generation_director.h"
+#include "game/world/chunk/generation/chunk_generation_budget/chunk_generation_budget.h"
+#include "game/world/chunk/generation/chunk_generation_budget/chunk_generation_budget_settings.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
 #include "game/world/world/world.h"
 
 using namespace			game;
@@ -23,12 +25,16 @@ using					generation_status = chunk_generation_worker::generation_status;
 						chunk_generation_worker::chunk_generation_worker
 						(
 							const shared_ptr<chunk> &chunk,
-							bool generate_landscape_and_decorations
+							bool generate_landscape_and_decorations,
+							bool apply_pending_writes
 						) :
 							is_workflow_stopped(false),
 							should_switch_task(true),
+							should_apply_pending_writes(apply_pending_writes),
 							status(generate_landscape_and_decorations ? null : generated_decorations),
-							next_status(generate_landscape_and_decorations ? null : generated_light)
+							next_status(generate_landscape_and_decorations ? null : generated_light),
+							is_first_build(generate_landscape_and_decorations),
+							creation_time(engine::clock::now())
 {
 	workspace = make_unique<chunk_workspace>(chunk);
 }
@@ -40,7 +46,12 @@ generation_status		chunk_generation_worker::get_status() const
 
 optional<chunk_build>	chunk_generation_worker::process(bool try_build_at_once)
 {
-	engine::timer		timer{ processing_limit };
+	engine::timer		timer
+	{
+		try_build_at_once ?
+		chunk_generation_budget_settings::forced_build_limit :
+		chunk_generation_budget::get_budget()
+	};
 
 	while (true)
 	{
@@ -54,6 +65,10 @@ optional<chunk_build>	chunk_generation_worker::process(bool try_build_at_once)
 			break;
 		if (not try_build_at_once)
 			break;
+
+		// Completions are delivered through director, so forced build awaits its task right here
+		wait_for_finish_of_task();
+		chunk_generation_director::process_completed_tasks();
 	}
 
 	return nullopt;
@@ -70,9 +85,9 @@ void 					chunk_generation_worker::wait_for_finish_of_task()
 		task->wait();
 }
 
-void					chunk_generation_worker::share_workspace(chunk_generation_worker &target) const
+bool					chunk_generation_worker::did_apply_pending_writes() const
 {
-	workspace->share(*target.workspace);
+	return not should_apply_pending_writes;
 }
 
 bool 					chunk_generation_worker::is_busy() const
@@ -80,12 +95,35 @@ bool 					chunk_generation_worker::is_busy() const
 	return task != nullptr and task->get_state() == chunk_generation_task::launched;
 }
 
-void					chunk_generation_worker::when_notified(const chunk_generation_task_notification &notification)
+float					chunk_generation_worker::get_average_task_time(generation_status status)
+{
+	if (number_of_tasks[status] == 0)
+		return 0.f;
+
+	return engine::clock::to_seconds(task_times[status]) / (float)number_of_tasks[status];
+}
+
+float					chunk_generation_worker::get_average_time_to_first_model()
 {
-	if (type_utility::is_of_type<chunk_generation_task_done>(notification))
+	if (number_of_first_models == 0)
+		return 0.f;
+
+	return engine::clock::to_seconds(time_to_first_model) / (float)number_of_first_models;
+}
+
+void					chunk_generation_worker::when_notified(const chunk_generation_task_done &notification)
+{
+	// Notification comes on main thread, so statistics don't need synchronization
+	task_times[next_status] += task->get_launch_time();
+	number_of_tasks[next_status]++;
+
+	status = next_status;
+	should_switch_task = true;
+
+	if (status == generated_model and is_first_build)
 	{
-		status = next_status;
-		should_switch_task = true;
+		time_to_first_model += engine::clock::now() - creation_time;
+		number_of_first_models++;
 	}
 }
 
@@ -102,6 +140,11 @@ chunk_build				chunk_generation_worker::package_build() const
     chunkBuild.model_for_transparent = workspace->batch_for_transparent.model;
     chunkBuild.model_for_partially_transparent = workspace->batch_for_partially_transparent.model;
 
+	chunkBuild.transparent_quad_centers = workspace->batch_for_transparent.quad_centers;
+	chunkBuild.transparent_indices = workspace->batch_for_transparent.indices;
+
+	chunkBuild.connectivity = workspace->connectivity;
+
 	return chunkBuild;
 }
 
@@ -123,7 +166,23 @@ void					chunk_generation_worker::switch_task()
 	{
 		case generation_status::null:
 		{
-			set_task(new chunk_landscape_generation_task());
+			if (chunk_storage::is_enabled() and chunk_storage::exists(workspace->chunk->get_position()))
+			{
+				set_task(new chunk_loading_task(biome_generator::get_config(), chunk_generation_director::get_pending_writes()));
+				next_status = generation_status::generated_decorations;
+				should_switch_task = false;
+				break;
+			}
+
+			set_task(new chunk_surface_generation_task());
+			next_status = generation_status::generated_surface;
+			should_switch_task = false;
+			break;
+		}
+
+		case generation_status::generated_surface:
+		{
+			set_task(new chunk_landscape_generation_task(biome_generator::get_config()));
 			next_status = generation_status::generated_landscape;
 			should_switch_task = false;
 			break;
@@ -131,10 +190,7 @@ void					chunk_generation_worker::switch_task()
 
 		case generation_status::generated_landscape:
 		{
-			if (not can_launch_decoration_generation_task())
-				break;
-
-			set_task(new chunk_decoration_generation_task());
+			set_task(new chunk_decoration_generation_task(chunk_generation_director::get_pending_writes()));
 			next_status = generation_status::generated_decorations;
 			should_switch_task = false;
 			break;
@@ -142,6 +198,16 @@ void					chunk_generation_worker::switch_task()
 
 		case generation_status::generated_decorations:
 		{
+			if (not can_launch_light_generation_task())
+				break;
+
+			// All neighbors are decorated, so every structure, that reaches into this chunk, is already stored
+			if (should_apply_pending_writes)
+			{
+				chunk_generation_director::get_pending_writes().apply(*workspace->chunk);
+				should_apply_pending_writes = false;
+			}
+
 			set_task(new chunk_light_generation_task());
 			next_status = generation_status::generated_light;
 			should_switch_task = false;
@@ -209,14 +275,14 @@ void 					chunk_generation_worker::set_task(chunk_generation_task *task)
 	this->task->subscribe(*this);
 }
 
-bool					chunk_generation_worker::can_launch_decoration_generation_task() const
+bool					chunk_generation_worker::can_launch_light_generation_task() const
 {
-	static const auto	is_chunk_present_and_has_landscape = [](const vec3 &position)
+	static const auto	is_chunk_present_and_has_decorations = [](const vec3 &position)
 	{
 		if (auto chunk = world::find_chunk(position); chunk != nullptr)
 		{
 			if (chunk_generation_director::have_worker(chunk))
-				return chunk_generation_director::find_worker(chunk).status >= generated_landscape;
+				return chunk_generation_director::find_worker(chunk).status >= generated_decorations;
 		}
 
 		return false;
@@ -226,14 +292,14 @@ bool					chunk_generation_worker::can_launch_decoration_generation_task() const
 
 	return
 	(
-		is_chunk_present_and_has_landscape(chunk_position + chunk::left_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::left_offset + chunk::forward_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::left_offset + chunk::back_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::right_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::right_offset + chunk::forward_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::right_offset + chunk::back_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::forward_offset) and
-		is_chunk_present_and_has_landscape(chunk_position + chunk::back_offset)
+		is_chunk_present_and_has_decorations(chunk_position + chunk::left_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::left_offset + chunk::forward_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::left_offset + chunk::back_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::right_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::right_offset + chunk::forward_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::right_offset + chunk::back_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::forward_offset) and
+		is_chunk_present_and_has_decorations(chunk_position + chunk::back_offset)
 	);
 }
 
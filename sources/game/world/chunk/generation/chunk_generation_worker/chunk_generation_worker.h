@@ -4,8 +4,10 @@
 #include "application/common/imports/glm.h"
 #include "application/common/templates/notifier_and_listener/listener.h"
 
+#include "engine/main/system/time/clock/clock.h"
+
 #include "game/world/chunk/generation/utilities/chunk_build/chunk_build.h"
-#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_notification.h"
+#include "game/world/chunk/generation/chunk_generation_task/notifications/chunk_generation_task_done.h"
 
 namespace								game
 {
@@ -17,13 +19,14 @@ namespace								game
 }
 
 class									game::chunk_generation_worker final :
-											public listener<game::chunk_generation_task_notification>
+											public listener<game::chunk_generation_task_done>
 {
 public :
 
 	enum								generation_status
 	{
 		null,
+		generated_surface,
 		generated_landscape,
 		generated_decorations,
 		generated_light,
@@ -31,26 +34,34 @@ public :
 		generated_model
 	};
 
+	static constexpr int				number_of_statuses = generated_model + 1;
+
 	explicit							chunk_generation_worker
 										(
 											const shared_ptr<chunk> &chunk,
-											bool generate_landscape_and_decorations = true
+											bool generate_landscape_and_decorations = true,
+											bool apply_pending_writes = true
 										);
 										~chunk_generation_worker() = default;
 
 	generation_status					get_status() const;
 	bool 								is_busy() const;
 
+	// Writes of neighbors are applied only once, so rebuild doesn't restore blocks, that player has changed since
+	bool								did_apply_pending_writes() const;
+
 	optional<chunk_build>				process(bool try_build_at_once = false);
 
 	void 								stop_workflow();
 	void 								wait_for_finish_of_task();
 
-	void								share_workspace(chunk_generation_worker &target) const;
+	// Average time in seconds of task, that produces given status
+	static float						get_average_task_time(generation_status status);
 
-private :
+	// Average time in seconds from creation of worker for new chunk to its first model
+	static float						get_average_time_to_first_model();
 
-	static constexpr float				processing_limit = 10.f / 60.f;
+private :
 
 	bool 								is_workflow_stopped;
 	unique_ptr<chunk_workspace>			workspace;
@@ -59,8 +70,20 @@ private :
 	generation_status					status;
 	generation_status					next_status;
 	bool 								should_switch_task;
+	bool								should_apply_pending_writes;
+
+	const bool							is_first_build;
+	const engine::clock::ticks			creation_time;
+
+	static inline array<engine::clock::ticks, number_of_statuses>
+										task_times = {};
+	static inline array<int, number_of_statuses>
+										number_of_tasks = {};
+
+	static inline engine::clock::ticks	time_to_first_model = 0;
+	static inline int					number_of_first_models = 0;
 
-	void								when_notified(const chunk_generation_task_notification &notification) override;
+	void								when_notified(const chunk_generation_task_done &notification) override;
 
 	bool 								is_build_ready() const;
 	chunk_build							package_build() const;
@@ -74,6 +97,6 @@ private :
 	void 								unset_task();
 	void 								set_task(chunk_generation_task *task);
 
-	bool								can_launch_decoration_generation_task() const;
+	bool								can_launch_light_generation_task() const;
 	bool								can_launch_geometry_generation_task() const;
 };
\ No newline at end of file
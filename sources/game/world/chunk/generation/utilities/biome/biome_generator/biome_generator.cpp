@@ -4,16 +4,40 @@
 
 using namespace					game;
 
+void							biome_generator::setup(const world_config &config)
+{
+	debug::check_critical(biome_configs.empty(), "[game::biome_generator] Biomes are already registered");
+
+	biome_generator::config = config;
+
+	noise_for_cell = config.get_noise_backend().create_cellular_2d(config.seed, 0.0018f);
+	noise_for_cell_shift = config.get_noise_backend().create_gradient_2d(config.seed, 0.02f);
+}
+
+const world_config				&biome_generator::get_config()
+{
+	return config;
+}
+
 shared_ptr<biomes::abstract>	biome_generator::generate_biome(const vec2 &column)
 {
-	const auto 					shift_x = noise_for_cell_shift({column.x, column.y});
-	const auto 					shift_y = noise_for_cell_shift({column.y, column.x});
+	return get_biome(generate_biome_id(column));
+}
+
+int								biome_generator::generate_biome_id(const vec2 &column)
+{
+	const auto 					shift_x = (*noise_for_cell_shift)({column.x, column.y}) * cell_shift;
+	const auto 					shift_y = (*noise_for_cell_shift)({column.y, column.x}) * cell_shift;
 	const auto					shift = vec2(shift_x, shift_y);
 
-	const auto					cell = noise_for_cell(column + shift);
-	const auto					biome_noise = noise_for_selection(cell.position);
+	const auto					biome_noise = (*noise_for_cell)(column + shift);
+
+	return select_biome_id(biome_noise);
+}
 
-	return select_biome(biome_noise);
+shared_ptr<biomes::abstract>	biome_generator::get_biome(int id)
+{
+	return biome_configs[id].biome;
 }
 
 void 							biome_generator::updated_ranges()
@@ -33,14 +57,14 @@ void 							biome_generator::updated_ranges()
 	}
 }
 
-shared_ptr<biomes::abstract>		biome_generator::select_biome(float value)
+int								biome_generator::select_biome_id(float value)
 {
-	for (const auto &biome_with_range : biome_configs)
+	for (int id = 0; id < (int)biome_configs.size(); id++)
 	{
-		if (value >= biome_with_range.min and value < biome_with_range.max)
-			return biome_with_range.biome;
+		if (value >= biome_configs[id].min and value < biome_configs[id].max)
+			return id;
 	}
 
 	debug::raise_error("[biome_manager] Biome not found");
-	return nullptr;
-}
+	return 0;
+}
\ No newline at end of file
@@ -2,10 +2,9 @@
 
 #include "application/common/imports/std.h"
 #include "application/common/imports/glm.h"
-#include "application/common/defines.h"
 
-#include "game/world/chunk/generation/utilities/noise/cellular_noise.h"
-#include "game/world/chunk/generation/utilities/noise/perlin_noise_2d.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+#include "game/world/world/world_config.h"
 #include "game/world/chunk/generation/utilities/biome/biomes/abstract/abstract.h"
 
 namespace									game
@@ -22,12 +21,20 @@ public :
 	{
 		static_assert(std::is_base_of<biomes::abstract, T>::value, "Given type is not derived from 'biomes::abstract'");
 
-		biome_configs.push_back({make_shared<T>(), weight, 0, 0});
+		biome_configs.push_back({make_shared<T>(config), weight, 0, 0});
 		updated_ranges();
 	}
 
+	// Creates noise for given world, should be called before biomes are registered
+	static void								setup(const world_config &config);
+	static const world_config				&get_config();
+
 	static shared_ptr<biomes::abstract>		generate_biome(const vec2 &column);
 
+	// Id is index of biome in order of registration, so it can be stored compactly
+	static int								generate_biome_id(const vec2 &column);
+	static shared_ptr<biomes::abstract>		get_biome(int id);
+
 private :
 
 	struct									biome_config
@@ -39,12 +46,15 @@ private :
 		float								max;
 	};
 
-	static inline cellular_noise			noise_for_cell {FT_VOX_SEED, 0.0018f};
-	static inline perlin_noise_2d			noise_for_cell_shift {FT_VOX_SEED, 0.02f, 50.f};
-	static inline random_noise_1d			noise_for_selection {FT_VOX_SEED};
+	static constexpr float					cell_shift = 50.f;
+
+	static inline world_config				config;
+
+	static inline unique_ptr<noise_2d>		noise_for_cell;
+	static inline unique_ptr<noise_2d>		noise_for_cell_shift;
 
-	static inline list<biome_config>		biome_configs = {};
+	static inline vector<biome_config>		biome_configs = {};
 
 	static void 							updated_ranges();
-	static shared_ptr<biomes::abstract>		select_biome(float value);
+	static int								select_biome_id(float value);
 };
\ No newline at end of file
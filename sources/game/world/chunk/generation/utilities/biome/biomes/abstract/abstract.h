@@ -3,6 +3,11 @@
 #include "game/world/block/block_type/block_type/block_type.h"
 #include "game/world/block/block_ptr/block_ptr.h"
 
+namespace				game
+{
+	class				structure_writer;
+}
+
 namespace				game::biomes
 {
 	class 				abstract;
@@ -16,5 +21,7 @@ public :
 
 	virtual int			generate_height(const vec2 &column) const = 0;
 	virtual block_type	generate_block(int current_height, int total_height, bool is_cave, bool is_cloud) const = 0;
-	virtual void		generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const = 0;
+
+	// Blocks outside of given one's chunk should be placed only through writer
+	virtual void		generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const = 0;
 };
\ No newline at end of file
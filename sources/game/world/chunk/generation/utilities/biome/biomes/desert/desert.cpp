@@ -2,7 +2,9 @@
 
 using namespace		game::biomes;
 
-					desert::desert() : decoration_generator(0.07f, 0.97f)
+					desert::desert(const world_config &config) :
+						height_generator(config),
+						decoration_generator(config, 0.07f, 0.97f)
 {
 	height_generator.add_layer(0.02f, 25.f, 1.5f);
 	height_generator.add_layer(0.08f, 10.f, 1.f);
@@ -23,7 +25,7 @@ game::block_type	desert::generate_block(int current_height, int total_height, bo
 		return block_type::sand;
 }
 
-void				desert::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const
+void				desert::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const
 {
 	const auto		block_position = block.get_world_position();
 	const auto 		column_position = vec2(block_position.x, block_position.z);
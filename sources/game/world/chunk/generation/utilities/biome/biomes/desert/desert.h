@@ -13,12 +13,12 @@ class						game::biomes::desert : public game::biomes::abstract
 {
 public :
 
-							desert();
+	explicit				desert(const world_config &config);
 							~desert() override = default;
 
 	int						generate_height(const vec2 &column) const override;
 	block_type				generate_block(int current_height, int total_height, bool is_cave, bool is_cloud) const override;
-	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const override;
+	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const override;
 
 private :
 
@@ -1,13 +1,13 @@
 #include "forest.h"
 
-#include "game/world/chunk/generation/utilities/tree_builder/tree_builder.h"
-
 using namespace		game::biomes;
 
-					forest::forest() :
-						tree_generator(0.8f, 0.90f),
-						mushroom_generator(0.8f, 0.85f),
-						grass_generator(0.4f, 0.97f)
+					forest::forest(const world_config &config) :
+						height_generator(config),
+						tree_generator(config, 0.8f, 0.90f),
+						mushroom_generator(config, 0.8f, 0.85f),
+						grass_generator(config, 0.4f, 0.97f),
+						tree_builder(config)
 {
 	height_generator.add_layer(0.01f, 18.f, 1.f);
 	height_generator.add_layer(0.08f, 4.f, 1.f);
@@ -30,7 +30,7 @@ game::block_type	forest::generate_block(int current_height, int total_height, bo
 		return block_type::dirt;
 }
 
-void				forest::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const
+void				forest::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const
 {
 	const auto		block_position = block.get_world_position();
 	const auto 		column_position = vec2(block_position.x, block_position.z);
@@ -45,7 +45,7 @@ void				forest::generate_decoration(const block_ptr &block, bool is_height_affec
 				(int)column_position.y % 2 == 0
 			)
 			{
-				tree_builder::build(block);
+				tree_builder.build(writer, block.get_index());
 			}
 		}
 		else if (mushroom_generator(column_position))
@@ -3,6 +3,7 @@
 #include "game/world/chunk/generation/utilities/biome/biomes/abstract/abstract.h"
 #include "game/world/chunk/generation/utilities/height_generator/height_generator.h"
 #include "game/world/chunk/generation/utilities/decoration_generator/decoration_generator.h"
+#include "game/world/chunk/generation/utilities/tree_builder/tree_builder.h"
 
 
 namespace					game::biomes
@@ -13,12 +14,12 @@ namespace					game::biomes
 class						game::biomes::forest : public game::biomes::abstract
 {
 public :
-							forest();
+	explicit				forest(const world_config &config);
 							~forest() override = default;
 
 	int						generate_height(const vec2 &column) const override;
 	block_type				generate_block(int current_height, int total_height, bool is_cave, bool is_cloud) const override;
-	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const override;
+	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const override;
 
 private :
 
@@ -26,4 +27,5 @@ private :
 	decoration_generator	tree_generator;
 	decoration_generator	grass_generator;
 	decoration_generator	mushroom_generator;
+	tree_builder			tree_builder;
 };
\ No newline at end of file
@@ -2,7 +2,9 @@
 
 using namespace		game::biomes;
 
-					lakes::lakes() : grass_generator(0.8f, 0.80f)
+					lakes::lakes(const world_config &config) :
+						height_generator(config),
+						grass_generator(config, 0.8f, 0.80f)
 {
 	height_generator.add_layer(0.04f, 8.f, 1.f);
 	height_generator.add_layer(0.008f, -14.f, 1.f);
@@ -25,7 +27,7 @@ game::block_type	lakes::generate_block(int current_height, int total_height, boo
 		return generate_solid_block(current_height, total_height);
 }
 
-void				lakes::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const
+void				lakes::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const
 {
 	const auto		block_position = block.get_world_position();
 	const auto 		column_position = vec2(block_position.x, block_position.z);
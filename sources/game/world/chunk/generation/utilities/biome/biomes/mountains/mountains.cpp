@@ -2,7 +2,9 @@
 
 using namespace		game::biomes;
 
-					mountains::mountains() : snow_generator(0.2f, 0.4f)
+					mountains::mountains(const world_config &config) :
+						height_generator(config),
+						snow_generator(config, 0.2f, 0.4f)
 {
 	height_generator.add_layer(0.008f, 100.f, 3.f);
 	height_generator.add_layer(0.08f, 20.f, 1.f);
@@ -23,7 +25,7 @@ game::block_type	mountains::generate_block(int current_height, int total_height,
 		return block_type::stone;
 }
 
-void				mountains::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const
+void				mountains::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const
 {
 	if (not is_height_affected_by_cave and block.get_world_position().y >= (float) snow_level)
 	{
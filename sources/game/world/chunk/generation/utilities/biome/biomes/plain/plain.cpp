@@ -1,12 +1,12 @@
 #include "plain.h"
 
-#include "game/world/chunk/generation/utilities/tree_builder/tree_builder.h"
-
 using namespace		game::biomes;
 
-					plain::plain() :
-						tree_generator(0.05f, 0.98f),
-						grass_generator(0.5f, 0.80f)
+					plain::plain(const world_config &config) :
+						height_generator(config),
+						tree_generator(config, 0.05f, 0.98f),
+						grass_generator(config, 0.5f, 0.80f),
+						tree_builder(config)
 {
 	height_generator.add_layer(0.01f, 18.f, 1.f);
 	height_generator.add_layer(0.08f, 4.f, 1.f);
@@ -29,7 +29,7 @@ game::block_type	plain::generate_block(int current_height, int total_height, boo
 		return block_type::dirt;
 }
 
-void				plain::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const
+void				plain::generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const
 {
     const auto		block_position = block.get_world_position();
     const auto 		column_position = vec2(block_position.x, block_position.z);
@@ -44,7 +44,7 @@ void				plain::generate_decoration(const block_ptr &block, bool is_height_affect
 				(int)column_position.y % 7 == 0
 			)
 			{
-				tree_builder::build(block);
+				tree_builder.build(writer, block.get_index());
 			}
 		}
 		else if (grass_generator(column_position))
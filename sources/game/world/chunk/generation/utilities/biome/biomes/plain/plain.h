@@ -3,6 +3,7 @@
 #include "game/world/chunk/generation/utilities/biome/biomes/abstract/abstract.h"
 #include "game/world/chunk/generation/utilities/height_generator/height_generator.h"
 #include "game/world/chunk/generation/utilities/decoration_generator/decoration_generator.h"
+#include "game/world/chunk/generation/utilities/tree_builder/tree_builder.h"
 
 
 namespace					game::biomes
@@ -14,16 +15,17 @@ class						game::biomes::plain : public game::biomes::abstract
 {
 public :
 
-							plain();
+	explicit				plain(const world_config &config);
 							~plain() override = default;
 
 	int						generate_height(const vec2 &column) const override;
 	block_type				generate_block(int current_height, int total_height, bool is_cave, bool is_cloud) const override;
-	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave) const override;
+	void					generate_decoration(const block_ptr &block, bool is_height_affected_by_cave, structure_writer &writer) const override;
 
 private :
 
 	height_generator		height_generator;
 	decoration_generator	tree_generator;
 	decoration_generator	grass_generator;
+	tree_builder			tree_builder;
 };
\ No newline at end of file
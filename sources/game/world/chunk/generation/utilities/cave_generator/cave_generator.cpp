@@ -1,10 +1,9 @@
 #include "cave_generator.h"
 
-#include "application/common/defines.h"
-
 using namespace	game;
 
-				cave_generator::cave_generator() : noise(FT_VOX_SEED, 0.02f)
+				cave_generator::cave_generator(const world_config &config) :
+					noise(config.get_noise_backend().create_gradient_3d(config.seed, 0.02f))
 {}
 
 bool 			cave_generator::operator () (const vec3 &position)
@@ -12,5 +11,5 @@ bool 			cave_generator::operator () (const vec3 &position)
 	if (position.y == 0)
 		return false;
 
-	return noise(position) < 0.22f;
+	return (*noise)(position) < 0.22f;
 }
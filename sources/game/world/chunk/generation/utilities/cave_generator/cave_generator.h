@@ -1,6 +1,7 @@
 #pragma once
 
-#include "game/world/chunk/generation/utilities/noise/perlin_noise_3d.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+#include "game/world/world/world_config.h"
 
 namespace			game
 {
@@ -10,10 +11,11 @@ namespace			game
 class				game::cave_generator
 {
 public :
-					cave_generator();
+	explicit		cave_generator(const world_config &config);
 	bool 			operator () (const vec3 &position);
 
 private :
 
-	perlin_noise_3d	noise;
+	unique_ptr<noise_3d>
+					noise;
 };
\ No newline at end of file
@@ -1,5 +1,12 @@
 #pragma once
 
+#include "application/common/imports/opengl.h"
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+#include "game/world/chunk/chunk/chunk_settings.h"
+#include "game/world/chunk/section_connectivity/section_connectivity.h"
+
 namespace						engine
 {
 	class						model;
@@ -15,4 +22,11 @@ struct							game::chunk_build
 	shared_ptr<engine::model>	model_for_opaque;
 	shared_ptr<engine::model>	model_for_transparent;
 	shared_ptr<engine::model>	model_for_partially_transparent;
+
+	// Kept on CPU, so transparent quads can be re-sorted without rebuilding the model
+	vector<vec3>				transparent_quad_centers;
+	vector<GLuint>				transparent_indices;
+
+	array<section_connectivity, chunk_settings::number_of_sections>
+								connectivity;
 };
\ No newline at end of file
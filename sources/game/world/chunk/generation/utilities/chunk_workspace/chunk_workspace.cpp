@@ -33,6 +33,7 @@ void						chunk_workspace::reset()
 		batch.texture_coordinates.clear();
 		batch.light_levels.clear();
 		batch.indices.clear();
+		batch.quad_centers.clear();
 
 		batch.model = nullptr;
 	};
@@ -43,9 +44,4 @@ void						chunk_workspace::reset()
 	reset_batch(batch_for_opaque);
 	reset_batch(batch_for_transparent);
 	reset_batch(batch_for_partially_transparent);
-}
-
-void						chunk_workspace::share(chunk_workspace &target)
-{
-	target.column_infos = this->column_infos;
 }
\ No newline at end of file
@@ -4,8 +4,8 @@
 
 #include "game/world/block/block_ptr/block_ptr.h"
 #include "game/world/chunk/chunk/chunk_settings.h"
+#include "game/world/chunk/section_connectivity/section_connectivity.h"
 #include "game/world/chunk/generation/chunk_generation_task/chunk_generation_task/chunk_generation_task.h"
-#include "game/world/chunk/generation/utilities/biome/biomes/abstract/abstract.h"
 
 namespace								engine
 {
@@ -33,33 +33,26 @@ public :
 		vector<float>					texture_coordinates;
 		vector<float>					light_levels;
 		vector<uint>					indices;
+		vector<vec3>					quad_centers;
 
 		shared_ptr<engine::model>		model;
 	};
 
-	struct								column_info
-	{
-		shared_ptr<biomes::abstract>	biome;
-		int								final_height;
-		bool							is_height_affected_by_cave;
-	};
-
 public :
 
 	explicit							chunk_workspace(const shared_ptr<chunk> &chunk);
 										~chunk_workspace();
 
 	void								reset();
-	void								share(chunk_workspace &target);
 
 	const shared_ptr<chunk>				chunk;
 
-	using								column_info_array = array3<column_info, chunk_settings::size[0], 1, chunk_settings::size[2]>;
-	column_info_array					column_infos;
-
 	optional<future<void>>				landscape_future;
 	optional<future<void>>				light_future;
 
+	array<section_connectivity, chunk_settings::number_of_sections>
+										connectivity;
+
 	batch								batch_for_opaque;
 	batch								batch_for_transparent;
  	batch								batch_for_partially_transparent;
@@ -1,10 +1,9 @@
 #include "cloud_generator.h"
 
-#include "application/common/defines.h"
-
 using namespace	game;
 
-				cloud_generator::cloud_generator() : noise(FT_VOX_SEED, 0.03f)
+				cloud_generator::cloud_generator(const world_config &config) :
+					noise(config.get_noise_backend().create_gradient_2d(config.seed, 0.03f))
 {}
 
 bool 			cloud_generator::operator () (const vec3 &position)
@@ -12,5 +11,5 @@ bool 			cloud_generator::operator () (const vec3 &position)
 	if (position.y != 220)
 		return false;
 
-	return noise({position.x, position.z}) > 0.65f;
+	return (*noise)({position.x, position.z}) > 0.65f;
 }
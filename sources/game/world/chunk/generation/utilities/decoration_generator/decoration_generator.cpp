@@ -1,15 +1,13 @@
 #include "decoration_generator.h"
 
-#include "application/common/defines.h"
-
 using namespace	game;
 
-				decoration_generator::decoration_generator(float frequency, float area) :
-					noise(FT_VOX_SEED, frequency),
-					area(area)
+				decoration_generator::decoration_generator(const world_config &config, float frequency, float area) :
+					area(area),
+					noise(config.get_noise_backend().create_gradient_2d(config.seed, frequency))
 {}
 
 bool 			decoration_generator::operator () (const vec2 &column) const
 {
-	return noise(column) > area;
+	return (*noise)(column) > area;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
-#include "game/world/chunk/generation/utilities/noise/perlin_noise_2d.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+#include "game/world/world/world_config.h"
 
 namespace			game
 {
@@ -11,11 +12,12 @@ class				game::decoration_generator
 {
 public :
 
-					decoration_generator(float frequency, float area);
+					decoration_generator(const world_config &config, float frequency, float area);
 	bool 			operator () (const vec2 &column)const;
 
 private :
 
 	float			area;
-	perlin_noise_2d	noise;
+	unique_ptr<noise_2d>
+					noise;
 };
\ No newline at end of file
@@ -4,6 +4,8 @@
 
 using namespace		game;
 
+					height_generator::height_generator(const world_config &config) : config(config) {}
+
 int 				height_generator::operator () (const vec2 &column) const
 {
 #if FT_VOX_MULTILAYER_HEIGHT_NOISE
@@ -20,5 +22,5 @@ int 				height_generator::operator () (const vec2 &column) const
 
 void				height_generator::add_layer(float frequency, float multiplier, float power)
 {
-	layers.emplace_back(FT_VOX_SEED, frequency, multiplier, power);
+	layers.push_back({config.get_noise_backend().create_gradient_2d(config.seed, frequency), multiplier, power});
 }
\ No newline at end of file
@@ -3,7 +3,8 @@
 #include "application/common/defines.h"
 #include "application/common/imports/glm.h"
 
-#include "game/world/chunk/generation/utilities/noise/perlin_noise_2d.h"
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+#include "game/world/world/world_config.h"
 
 namespace					game
 {
@@ -14,10 +15,25 @@ class						game::height_generator
 {
 public :
 
+	explicit				height_generator(const world_config &config);
+
 	int 					operator () (const vec2 &column) const;
 	void					add_layer(float frequency, float multiplier, float power);
 
 private :
 
-	vector<perlin_noise_2d>	layers;
+	struct					layer
+	{
+		unique_ptr<noise_2d>	noise;
+		float					multiplier;
+		float					power;
+
+		float					operator () (const vec2 &column) const
+		{
+			return pow((*noise)(column), power) * multiplier;
+		}
+	};
+
+	const world_config		config;
+	vector<layer>			layers;
 };
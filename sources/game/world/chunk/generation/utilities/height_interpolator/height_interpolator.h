@@ -12,9 +12,35 @@ class					game::height_interpolator
 {
 public :
 
+	// Neighbors are sampled on grid with this step within this radius around column
+	static constexpr int	radius = 8;
+	static constexpr int	step = 2;
+
 	explicit			height_interpolator(const function<int(vec2)> &height_generator);
 	int					operator () (const vec2 &initial_position) const;
 
+	// Same interpolation, but height of each neighbor is taken from given getter by integer offset
+	template			<typename getter_type>
+	static int			interpolate(const getter_type &get_height_of_neighbor)
+	{
+		float			final_height = 0.f;
+		float			total_weight = 0.f;
+
+		for (int x = -radius; x <= radius; x += step)
+		for (int y = -radius; y <= radius; y += step)
+		{
+			const auto	height_of_neighbor = get_height_of_neighbor(x, y);
+			const auto	weight_of_neighbor = 1.f - 1.f / (1.f + (float)abs(x) + (float)abs(y));
+
+			final_height += (float)height_of_neighbor * weight_of_neighbor;
+			total_weight += weight_of_neighbor;
+		}
+
+		final_height /= total_weight;
+
+		return (int)final_height;
+	}
+
 private :
 
 	function<int(vec2)>	height_generator;
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "random_noise_2d.h"
+#include "hash_noise.h"
 
 namespace					game
 {
@@ -13,6 +13,7 @@ public :
 
 	struct					cell
 	{
+		ivec2				index = ivec2(0);
 		vec2				position = vec2(0.f);
 		float				distance = 0.f;
 	};
@@ -41,10 +42,7 @@ public :
             calculate_distance(current, input);
 
             if (nearest.distance > current.distance)
-            {
-                nearest.position = current.position;
-                nearest.distance = current.distance;
-            }
+                nearest = current;
         }
 
 		return (nearest);
@@ -56,11 +54,12 @@ private :
 	float 					frequency;
 	int 					seed;
 
-	random_noise_2d			random;
+	hash_noise				random;
 
 	void					position_determination(cell &cell, const vec2 &position) const
 	{
-		cell.position = position + random(position);
+		cell.index = ivec2(position);
+		cell.position = position + random.get_vector(cell.index);
 	}
 
 	void 					calculate_distance(cell &cell, const vec2 &point) const
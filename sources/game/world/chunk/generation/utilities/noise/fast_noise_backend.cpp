@@ -0,0 +1,113 @@
+#include "fast_noise_backend.h"
+
+#include "application/common/imports/FastNoise.h"
+
+#include "game/world/chunk/generation/utilities/noise/fast_noise_backend_settings.h"
+
+using namespace					game;
+
+static FastNoiseLite			create_gradient_noise(int seed, float frequency)
+{
+	FastNoiseLite				noise(seed);
+
+	noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+	noise.SetFrequency(frequency);
+
+	if (fast_noise_backend_settings::number_of_octaves > 1)
+	{
+		noise.SetFractalType(FastNoiseLite::FractalType_FBm);
+		noise.SetFractalOctaves(fast_noise_backend_settings::number_of_octaves);
+		noise.SetFractalLacunarity(fast_noise_backend_settings::lacunarity);
+		noise.SetFractalGain(fast_noise_backend_settings::gain);
+	}
+
+	return noise;
+}
+
+// FastNoiseLite returns values in [-1, 1], while generators expect [0, 1]
+static float					to_unit_range(float value)
+{
+	return clamp(value * 0.5f + 0.5f, 0.f, 1.f);
+}
+
+class							fast_noise_backend::gradient_2d : public noise_2d
+{
+public :
+								gradient_2d(int seed, float frequency) : noise(create_gradient_noise(seed, frequency)) {}
+
+	float						operator () (vec2 input) const override
+	{
+		return to_unit_range(noise.GetNoise(input.x, input.y));
+	}
+
+	void						generate_grid(const vec2 &origin, const ivec2 &size, float *output) const override
+	{
+		for (int x = 0; x < size.x; x++)
+		for (int y = 0; y < size.y; y++)
+			*output++ = to_unit_range(noise.GetNoise(origin.x + (float)x, origin.y + (float)y));
+	}
+
+private :
+
+	FastNoiseLite				noise;
+};
+
+class							fast_noise_backend::gradient_3d : public noise_3d
+{
+public :
+								gradient_3d(int seed, float frequency) : noise(create_gradient_noise(seed, frequency)) {}
+
+	float						operator () (vec3 input) const override
+	{
+		return to_unit_range(noise.GetNoise(input.x, input.y, input.z));
+	}
+
+	void						generate_grid(const vec3 &origin, const ivec3 &size, float *output) const override
+	{
+		for (int x = 0; x < size.x; x++)
+		for (int y = 0; y < size.y; y++)
+		for (int z = 0; z < size.z; z++)
+			*output++ = to_unit_range(noise.GetNoise(origin.x + (float)x, origin.y + (float)y, origin.z + (float)z));
+	}
+
+private :
+
+	FastNoiseLite				noise;
+};
+
+class							fast_noise_backend::cellular_2d : public noise_2d
+{
+public :
+								cellular_2d(int seed, float frequency) : noise(seed)
+	{
+		noise.SetNoiseType(FastNoiseLite::NoiseType_Cellular);
+		noise.SetFrequency(frequency);
+		noise.SetCellularDistanceFunction(FastNoiseLite::CellularDistanceFunction_EuclideanSq);
+		noise.SetCellularReturnType(FastNoiseLite::CellularReturnType_CellValue);
+	}
+
+	// Result is kept below one, so it can be used as selector in same way as native random noise
+	float						operator () (vec2 input) const override
+	{
+		return min(to_unit_range(noise.GetNoise(input.x, input.y)), 0.9999f);
+	}
+
+private :
+
+	FastNoiseLite				noise;
+};
+
+unique_ptr<noise_2d>			fast_noise_backend::create_gradient_2d(int seed, float frequency) const
+{
+	return make_unique<gradient_2d>(seed, frequency);
+}
+
+unique_ptr<noise_3d>			fast_noise_backend::create_gradient_3d(int seed, float frequency) const
+{
+	return make_unique<gradient_3d>(seed, frequency);
+}
+
+unique_ptr<noise_2d>			fast_noise_backend::create_cellular_2d(int seed, float frequency) const
+{
+	return make_unique<cellular_2d>(seed, frequency);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+
+namespace						game
+{
+	class						fast_noise_backend;
+}
+
+// Noise from FastNoiseLite : OpenSimplex2 with fractal FBm for gradient noise and cellular noise with cell values
+class							game::fast_noise_backend : public game::noise_backend
+{
+public :
+								fast_noise_backend() = default;
+								~fast_noise_backend() override = default;
+
+	unique_ptr<noise_2d>		create_gradient_2d(int seed, float frequency) const override;
+	unique_ptr<noise_3d>		create_gradient_3d(int seed, float frequency) const override;
+	unique_ptr<noise_2d>		create_cellular_2d(int seed, float frequency) const override;
+
+private :
+
+	class						gradient_2d;
+	class						gradient_3d;
+	class						cellular_2d;
+};
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace						game
+{
+	struct						fast_noise_backend_settings;
+}
+
+struct							game::fast_noise_backend_settings
+{
+	// Fractal FBm is used for gradient noise when there is more than one octave
+	static inline int			number_of_octaves = 2;
+	static inline float			lacunarity = 2.f;
+	static inline float			gain = 0.5f;
+};
\ No newline at end of file
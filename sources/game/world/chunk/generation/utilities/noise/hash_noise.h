@@ -0,0 +1,67 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+#include "application/common/imports/glm.h"
+
+namespace					game
+{
+	class					hash_noise;
+}
+
+// Random values for integer lattice points, based on PCG hash.
+// Uses only integer arithmetic, so results are same on every platform, compiler and optimization level.
+class						game::hash_noise
+{
+public :
+
+	explicit				hash_noise(int seed = 0) : seed((uint32_t)seed) {}
+							~hash_noise() = default;
+
+	uint32_t				hash(const ivec2 &input) const
+	{
+		return permute(seed ^ permute((uint32_t)input.x + permute((uint32_t)input.y)));
+	}
+
+	uint32_t				hash(const ivec3 &input) const
+	{
+		return permute(seed ^ permute((uint32_t)input.x + permute((uint32_t)input.y + permute((uint32_t)input.z))));
+	}
+
+	// Uniform value in [0, 1)
+	float					operator () (const ivec2 &input) const
+	{
+		return to_unit(hash(input));
+	}
+
+	float					operator () (const ivec3 &input) const
+	{
+		return to_unit(hash(input));
+	}
+
+	// Two independent uniform values in [0, 1)
+	vec2					get_vector(const ivec2 &input) const
+	{
+		const uint32_t		first = hash(input);
+		const uint32_t		second = permute(first);
+
+		return vec2(to_unit(first), to_unit(second));
+	}
+
+	static uint32_t			permute(uint32_t value)
+	{
+		const uint32_t		state = value * 747796405u + 2891336453u;
+		const uint32_t		word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+
+		return (word >> 22u) ^ word;
+	}
+
+	// Upper 24 bits fit into float mantissa exactly
+	static float			to_unit(uint32_t value)
+	{
+		return (float)(value >> 8u) * (1.f / 16777216.f);
+	}
+
+private :
+
+	uint32_t				seed;
+};
\ No newline at end of file
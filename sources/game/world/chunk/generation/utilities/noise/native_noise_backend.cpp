@@ -0,0 +1,69 @@
+#include "native_noise_backend.h"
+
+#include "game/world/chunk/generation/utilities/noise/perlin_noise_2d.h"
+#include "game/world/chunk/generation/utilities/noise/perlin_noise_3d.h"
+#include "game/world/chunk/generation/utilities/noise/cellular_noise.h"
+
+using namespace					game;
+
+class							native_noise_backend::gradient_2d : public noise_2d
+{
+public :
+								gradient_2d(int seed, float frequency) : noise(seed, frequency) {}
+
+	float						operator () (vec2 input) const override
+	{
+		return noise(input);
+	}
+
+private :
+
+	perlin_noise_2d				noise;
+};
+
+class							native_noise_backend::gradient_3d : public noise_3d
+{
+public :
+								gradient_3d(int seed, float frequency) : noise(seed, frequency) {}
+
+	float						operator () (vec3 input) const override
+	{
+		return noise(input);
+	}
+
+private :
+
+	perlin_noise_3d				noise;
+};
+
+class							native_noise_backend::cellular_2d : public noise_2d
+{
+public :
+								cellular_2d(int seed, float frequency) : noise(seed, frequency), random(seed) {}
+
+	// Value of cell is hash of its lattice index
+	float						operator () (vec2 input) const override
+	{
+		return random(noise(input).index);
+	}
+
+private :
+
+	cellular_noise				noise;
+	hash_noise					random;
+};
+
+unique_ptr<noise_2d>			native_noise_backend::create_gradient_2d(int seed, float frequency) const
+{
+	return make_unique<gradient_2d>(seed, frequency);
+}
+
+unique_ptr<noise_3d>			native_noise_backend::create_gradient_3d(int seed, float frequency) const
+{
+	return make_unique<gradient_3d>(seed, frequency);
+}
+
+unique_ptr<noise_2d>			native_noise_backend::create_cellular_2d(int seed, float frequency) const
+{
+	return make_unique<cellular_2d>(seed, frequency);
+}
\ No newline at end of file
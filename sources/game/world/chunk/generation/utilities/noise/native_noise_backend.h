@@ -0,0 +1,26 @@
+#pragma once
+
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+
+namespace						game
+{
+	class						native_noise_backend;
+}
+
+// Hand-written perlin and cellular noise on top of integer hash
+class							game::native_noise_backend : public game::noise_backend
+{
+public :
+								native_noise_backend() = default;
+								~native_noise_backend() override = default;
+
+	unique_ptr<noise_2d>		create_gradient_2d(int seed, float frequency) const override;
+	unique_ptr<noise_3d>		create_gradient_3d(int seed, float frequency) const override;
+	unique_ptr<noise_2d>		create_cellular_2d(int seed, float frequency) const override;
+
+private :
+
+	class						gradient_2d;
+	class						gradient_3d;
+	class						cellular_2d;
+};
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "noise_backend.h"
+
+#include "game/world/chunk/generation/utilities/noise/native_noise_backend.h"
+#include "game/world/chunk/generation/utilities/noise/fast_noise_backend.h"
+
+using namespace					game;
+
+void							noise_2d::generate_grid(const vec2 &origin, const ivec2 &size, float *output) const
+{
+	for (int x = 0; x < size.x; x++)
+	for (int y = 0; y < size.y; y++)
+		*output++ = (*this)(origin + vec2(x, y));
+}
+
+void							noise_3d::generate_grid(const vec3 &origin, const ivec3 &size, float *output) const
+{
+	for (int x = 0; x < size.x; x++)
+	for (int y = 0; y < size.y; y++)
+	for (int z = 0; z < size.z; z++)
+		*output++ = (*this)(origin + vec3(x, y, z));
+}
+
+const noise_backend				&noise_backend::get(type type)
+{
+	static const native_noise_backend	native;
+	static const fast_noise_backend		fast_noise;
+
+	switch (type)
+	{
+		case type::native :
+			return native;
+
+		case type::fast_noise :
+			return fast_noise;
+	}
+
+	return native;
+}
+
+string							noise_backend::get_name(type type)
+{
+	switch (type)
+	{
+		case type::native :
+			return "native";
+
+		case type::fast_noise :
+			return "fast_noise";
+	}
+
+	return "unknown";
+}
+
+optional<noise_backend::type>	noise_backend::find_type(const string &name)
+{
+	for (const auto type : {type::native, type::fast_noise})
+	{
+		if (get_name(type) == name)
+			return type;
+	}
+
+	return nullopt;
+}
\ No newline at end of file
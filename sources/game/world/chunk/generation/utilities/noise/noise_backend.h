@@ -0,0 +1,66 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+#include "application/common/imports/glm.h"
+
+namespace						game
+{
+	class						noise_2d;
+	class						noise_3d;
+	class						noise_backend;
+}
+
+// Single noise instance with fixed seed and frequency, values are roughly in [0, 1]
+class							game::noise_2d
+{
+public :
+
+	virtual						~noise_2d() = default;
+
+	virtual float				operator () (vec2 input) const = 0;
+
+	// Samples size.x * size.y points with unit step starting from origin, output is x-major
+	virtual void				generate_grid(const vec2 &origin, const ivec2 &size, float *output) const;
+};
+
+class							game::noise_3d
+{
+public :
+
+	virtual						~noise_3d() = default;
+
+	virtual float				operator () (vec3 input) const = 0;
+
+	// Samples size.x * size.y * size.z points with unit step starting from origin, output is x-major
+	virtual void				generate_grid(const vec3 &origin, const ivec3 &size, float *output) const;
+};
+
+// Creates noise instances for world generation, so generators don't depend on particular noise implementation.
+// Backend is a part of world configuration, see game::world_config.
+class							game::noise_backend
+{
+public :
+
+	enum class					type
+	{
+		native,
+		fast_noise
+	};
+
+	virtual						~noise_backend() = default;
+
+	// Smooth gradient noise, used for heights, caves, clouds and decorations
+	virtual unique_ptr<noise_2d>
+								create_gradient_2d(int seed, float frequency) const = 0;
+	virtual unique_ptr<noise_3d>
+								create_gradient_3d(int seed, float frequency) const = 0;
+
+	// Returns random value, that is constant within each cell of Voronoi diagram
+	virtual unique_ptr<noise_2d>
+								create_cellular_2d(int seed, float frequency) const = 0;
+
+	static const noise_backend	&get(type type);
+
+	static string				get_name(type type);
+	static optional<type>		find_type(const string &name);
+};
\ No newline at end of file
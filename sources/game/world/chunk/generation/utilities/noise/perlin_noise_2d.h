@@ -2,7 +2,7 @@
 
 #include "application/common/imports/std.h"
 
-#include "random_noise_1d.h"
+#include "hash_noise.h"
 
 namespace					game
 {
@@ -41,18 +41,12 @@ public :
 
 		const vec2			whole = floor(input);
 		const vec2			fractional = fract(input);
+		const ivec2			lattice = ivec2(whole);
 
-		static const float	pi_on_2 = M_PI * 2.f;
-
-		const float			top_left_angle = random(whole) * pi_on_2;
-		const float			top_right_angle = random(whole + vec2(1.0f, 0.0f)) * pi_on_2;
-		const float			bottom_left_angle = random(whole + vec2(0.0f, 1.0f)) * pi_on_2;
-		const float			bottom_right_angle = random(whole + vec2(1.0f, 1.0f)) * pi_on_2;
-
-		const vec2			top_left = rotate(vec2(1.f, 0.f), top_left_angle);
-		const vec2			top_right = rotate(vec2(1.f, 0.f), top_right_angle);
-		const vec2			bottom_left = rotate(vec2(1.f, 0.f), bottom_left_angle);
-		const vec2			bottom_right = rotate(vec2(1.f, 0.f), bottom_right_angle);
+		const vec2			&top_left = get_gradient(lattice);
+		const vec2			&top_right = get_gradient(lattice + ivec2(1, 0));
+		const vec2			&bottom_left = get_gradient(lattice + ivec2(0, 1));
+		const vec2			&bottom_right = get_gradient(lattice + ivec2(1, 1));
 
 		const float			top_left_dot = dot(top_left, fractional);
 		const float			top_right_dot = dot(top_right, fractional - vec2(1.0, 0.0));
@@ -78,5 +72,24 @@ private :
 	float 					multiplier;
 	float 					power;
 
-	random_noise_1d			random;
+	hash_noise				random;
+
+	// Gradients are taken from fixed table instead of rotating by random angle, so no trigonometry is involved
+	static inline const array<vec2, 8>
+							gradients =
+	{
+		vec2(1.f, 0.f),
+		vec2(0.70710678f, 0.70710678f),
+		vec2(0.f, 1.f),
+		vec2(-0.70710678f, 0.70710678f),
+		vec2(-1.f, 0.f),
+		vec2(-0.70710678f, -0.70710678f),
+		vec2(0.f, -1.f),
+		vec2(0.70710678f, -0.70710678f)
+	};
+
+	const vec2				&get_gradient(const ivec2 &lattice) const
+	{
+		return gradients[random.hash(lattice) & 7u];
+	}
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "random_noise_1d.h"
+#include "hash_noise.h"
 
 namespace					game
 {
@@ -27,38 +27,23 @@ public :
 
     float					operator () (vec3 input) const
     {
-		static const float	pi_on_2 = M_PI * 2.f;
-
         input *= frequency;
 
         const vec3			whole = floor(input);
         const vec3			fractional = fract(input);
+        const ivec3			lattice = ivec3(whole);
 
-        float				left_top_further_angle = random(whole) * pi_on_2;
-        float				left_top_nearest_angle = random(whole + vec3(0.0f, 0.0f, 1.0f)) * pi_on_2;
-
-        float				right_top_further_angle = random(whole + vec3(1.0f, 0.0f, 0.0f)) * pi_on_2;
-        float				right_top_nearest_angle = random(whole + vec3(1.0f, 0.0f, 1.0f)) * pi_on_2;
-
-        float				left_bottom_further_angle = random(whole + vec3(0.0f, 1.0f, 0.0f)) * pi_on_2;
-        float				left_bottom_nearest_angle = random(whole + vec3(0.0f, 1.0f, 1.0f)) * pi_on_2;
-
-        float				right_bottom_further_angle = random(whole + vec3(1.0f, 1.0f, 0.0f)) * pi_on_2;
-        float				right_bottom_nearest_angle = random(whole + vec3(1.0f, 1.0f, 1.0f)) * pi_on_2;
-
-        vec3                normal = normalize(vec3(1, 1, 1));
-
-        vec3				left_top_further = rotate(vec3(1.f, 0.f, 0.f), left_top_further_angle, normal);
-        vec3				left_top_nearest = rotate(vec3(1.f, 0.f, 0.f), left_top_nearest_angle, normal);
+        const vec3			&left_top_further = get_gradient(lattice);
+        const vec3			&left_top_nearest = get_gradient(lattice + ivec3(0, 0, 1));
 
-        vec3				right_top_further = rotate(vec3(1.f, 0.f, 0.f), right_top_further_angle, normal);
-        vec3				right_top_nearest = rotate(vec3(1.f, 0.f, 0.f), right_top_nearest_angle, normal);
+        const vec3			&right_top_further = get_gradient(lattice + ivec3(1, 0, 0));
+        const vec3			&right_top_nearest = get_gradient(lattice + ivec3(1, 0, 1));
 
-        vec3				left_bottom_further = rotate(vec3(1.f, 0.f, 0.f), left_bottom_further_angle, normal);
-        vec3				left_bottom_nearest = rotate(vec3(1.f, 0.f, 0.f), left_bottom_nearest_angle, normal);
+        const vec3			&left_bottom_further = get_gradient(lattice + ivec3(0, 1, 0));
+        const vec3			&left_bottom_nearest = get_gradient(lattice + ivec3(0, 1, 1));
 
-        vec3				right_bottom_further = rotate(vec3(1.f, 0.f, 0.f), right_bottom_further_angle, normal);
-        vec3				right_bottom_nearest = rotate(vec3(1.f, 0.f, 0.f), right_bottom_nearest_angle, normal);
+        const vec3			&right_bottom_further = get_gradient(lattice + ivec3(1, 1, 0));
+        const vec3			&right_bottom_nearest = get_gradient(lattice + ivec3(1, 1, 1));
 
         float				left_top_further_dot = dot(left_top_further, fractional);
         float				left_top_nearest_dot = dot(left_top_nearest, fractional - vec3(0.f, 0.f, 1.f));
@@ -94,5 +79,32 @@ private :
 	float 					multiplier;
 	float 					shift;
 
-	random_noise_1d			random;
+	hash_noise				random;
+
+	// Normalized directions to edges of cube, four of them are repeated to make table size power of two
+	static inline const array<vec3, 16>
+							gradients =
+	{
+		vec3(0.70710678f, 0.70710678f, 0.f),
+		vec3(-0.70710678f, 0.70710678f, 0.f),
+		vec3(0.70710678f, -0.70710678f, 0.f),
+		vec3(-0.70710678f, -0.70710678f, 0.f),
+		vec3(0.70710678f, 0.f, 0.70710678f),
+		vec3(-0.70710678f, 0.f, 0.70710678f),
+		vec3(0.70710678f, 0.f, -0.70710678f),
+		vec3(-0.70710678f, 0.f, -0.70710678f),
+		vec3(0.f, 0.70710678f, 0.70710678f),
+		vec3(0.f, -0.70710678f, 0.70710678f),
+		vec3(0.f, 0.70710678f, -0.70710678f),
+		vec3(0.f, -0.70710678f, -0.70710678f),
+		vec3(0.70710678f, 0.70710678f, 0.f),
+		vec3(-0.70710678f, 0.70710678f, 0.f),
+		vec3(0.f, -0.70710678f, 0.70710678f),
+		vec3(0.f, -0.70710678f, -0.70710678f)
+	};
+
+	const vec3				&get_gradient(const ivec3 &lattice) const
+	{
+		return gradients[random.hash(lattice) & 15u];
+	}
 };
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "pending_block_writes.h"
+
+using namespace					game;
+
+void							pending_block_writes::store(const vec3 &source, writes_by_target &&new_writes)
+{
+	unique_lock					lock(mutex);
+
+	for (auto &[target, writes_for_target] : writes)
+		writes_for_target.erase(source);
+
+	for (auto &[target, writes_for_target] : new_writes)
+		writes[target][source] = move(writes_for_target);
+}
+
+void							pending_block_writes::discard(const vec3 &source)
+{
+	unique_lock					lock(mutex);
+
+	for (auto iterator = writes.begin(); iterator != writes.end();)
+	{
+		iterator->second.erase(source);
+
+		if (iterator->second.empty())
+			iterator = writes.erase(iterator);
+		else
+			++iterator;
+	}
+}
+
+pending_block_writes::writes_by_target
+								pending_block_writes::find(const vec3 &source) const
+{
+	shared_lock					lock(mutex);
+	writes_by_target			result;
+
+	for (const auto &[target, writes_for_target] : writes)
+	{
+		if (auto iterator = writes_for_target.find(source); iterator != writes_for_target.end())
+			result[target] = iterator->second;
+	}
+
+	return result;
+}
+
+void							pending_block_writes::apply(chunk &target) const
+{
+	vector<write>				sorted_writes;
+
+	{
+		shared_lock				lock(mutex);
+
+		if (auto iterator = writes.find(target.get_position()); iterator != writes.end())
+		{
+			for (const auto &[source, writes_from_source] : iterator->second)
+				sorted_writes.insert(sorted_writes.end(), writes_from_source.begin(), writes_from_source.end());
+		}
+	}
+
+	// If several structures touch same block, block type with greater value wins, no matter which came first
+	sort(sorted_writes.begin(), sorted_writes.end(), [](const write &left, const write &right)
+	{
+		return
+			tuple<int, int, int, int>(left.index.x, left.index.y, left.index.z, (int)left.type) <
+			tuple<int, int, int, int>(right.index.x, right.index.y, right.index.z, (int)right.type);
+	});
+
+	for (const auto &write : sorted_writes)
+		target.at(write.index).set_type(write.type);
+}
+
+int								pending_block_writes::get_number_of_writes() const
+{
+	shared_lock					lock(mutex);
+	int							number_of_writes = 0;
+
+	for (const auto &[target, writes_for_target] : writes)
+	for (const auto &[source, writes_from_source] : writes_for_target)
+		number_of_writes += (int)writes_from_source.size();
+
+	return number_of_writes;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+#include "application/common/imports/glm.h"
+
+#include "game/world/block/block_type/block_type/block_type.h"
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/chunk_map/chunk_map.h"
+
+namespace							game
+{
+	class							pending_block_writes;
+}
+
+// Blocks, that structures of one chunk place into its neighbors, grouped by target chunk.
+// Target chunk applies them after all of its neighbors are decorated, so decoration itself never touches neighbors.
+// Writes are kept until their source chunk is deleted, so target, that is unloaded and created again, receives them too.
+class								game::pending_block_writes
+{
+public :
+
+	struct							write
+	{
+		chunk::index				index;
+		block_type					type;
+	};
+
+	using							writes_by_target = unordered_map<vec3, vector<write>, vec3_hasher>;
+
+									pending_block_writes() = default;
+									~pending_block_writes() = default;
+
+	// Replaces writes, that were previously stored by given source chunk. Can be called from any thread
+	void							store(const vec3 &source, writes_by_target &&new_writes);
+	void							discard(const vec3 &source);
+
+	// Writes, that were stored by given source chunk
+	writes_by_target				find(const vec3 &source) const;
+
+	// Order of application doesn't depend on order, in which sources were decorated
+	void							apply(chunk &target) const;
+
+	int								get_number_of_writes() const;
+
+private :
+
+	using							writes_by_source = unordered_map<vec3, vector<write>, vec3_hasher>;
+
+	unordered_map<vec3, writes_by_source, vec3_hasher>
+									writes;
+
+	mutable shared_mutex			mutex;
+};
\ No newline at end of file
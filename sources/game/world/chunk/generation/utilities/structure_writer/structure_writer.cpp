@@ -0,0 +1,45 @@
+#include "structure_writer.h"
+
+#include "game/world/chunk/chunk_cache/chunk_cache.h"
+
+using namespace									game;
+
+												structure_writer::structure_writer(const shared_ptr<game::chunk> &chunk) :
+													chunk(chunk)
+{}
+
+void											structure_writer::set_type(const chunk::index &index, block_type type)
+{
+	if (index.is_valid())
+	{
+		chunk->at(index).set_type(type);
+		return;
+	}
+
+	if (index.y < 0 or index.y >= chunk_settings::size[1])
+		return;
+
+	const int									offset_x = chunk_cache::floor_divide(index.x, chunk_settings::size[0]);
+	const int									offset_z = chunk_cache::floor_divide(index.z, chunk_settings::size[2]);
+
+	const vec3									target = chunk->get_position() + vec3
+	(
+		offset_x * chunk_settings::size[0],
+		0,
+		offset_z * chunk_settings::size[2]
+	);
+
+	const chunk::index							index_in_target
+	(
+		index.x - offset_x * chunk_settings::size[0],
+		index.y,
+		index.z - offset_z * chunk_settings::size[2]
+	);
+
+	pending_writes[target].push_back({index_in_target, type});
+}
+
+pending_block_writes::writes_by_target			structure_writer::take_pending_writes()
+{
+	return move(pending_writes);
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/generation/utilities/pending_block_writes/pending_block_writes.h"
+
+namespace										game
+{
+	class										structure_writer;
+}
+
+// Places blocks of structures, that are generated by decoration of one chunk.
+// Blocks inside of chunk are written at once, blocks of neighbor chunks are collected for pending block writes.
+class											game::structure_writer
+{
+public :
+
+	explicit									structure_writer(const shared_ptr<chunk> &chunk);
+												~structure_writer() = default;
+
+	// Index is relative to chunk and may be outside of it horizontally, blocks above or below chunk are ignored
+	void										set_type(const chunk::index &index, block_type type);
+
+	pending_block_writes::writes_by_target		take_pending_writes();
+
+private :
+
+	const shared_ptr<chunk>						chunk;
+	pending_block_writes::writes_by_target		pending_writes;
+};
\ No newline at end of file
@@ -1,21 +1,20 @@
 #include "tree_builder.h"
 
-#include "game/world/chunk/generation/utilities/noise/random_noise_1d.h"
-
+#include "game/world/chunk/generation/utilities/structure_writer/structure_writer.h"
 
 using namespace		game;
 
-void				tree_builder::build(const block_ptr &block)
+					tree_builder::tree_builder(const world_config &config) : random(config.seed) {}
+
+void				tree_builder::build(structure_writer &writer, const chunk::index &root) const
 {
-	random_noise_1d	random(FT_VOX_SEED);
 	int				delta;
 
-	block_ptr		trunk_block = block;
-	block_ptr		leave_block;
+	chunk::index	trunk_index = root;
 
 	for (int y = 0; y < tree_height; y++)
 	{
-		trunk_block->set_type(block_type::wood);
+		writer.set_type(trunk_index, block_type::wood);
 
 		delta = tree_height - y;
 		if (delta <= 4)
@@ -29,25 +28,11 @@ void				tree_builder::build(const block_ptr &block)
 				if (x == 0 && z == 0)
 					continue;
 
-				if (random({x, z + y}) > 0.1)
-				{
-					leave_block = trunk_block.get_neighbor({x, 0, z});
-					validate_leave_block(leave_block);
-
-					leave_block->set_type(block_type::leaves);
-				}
+				if (random(ivec2(x, z + y)) > 0.1)
+					writer.set_type(trunk_index + chunk::index(x, 0, z), block_type::leaves);
 			}
 		}
 
-		trunk_block = trunk_block.get_neighbor({0, 1, 0});
+		trunk_index = trunk_index + chunk::index(0, 1, 0);
 	}
-}
-
-void				tree_builder::validate_leave_block(const block_ptr &block)
-{
-	debug::check_critical
-	(
-		block != nullptr,
-		"[game::tree_builder] Leave block is null"
-	);
 }
\ No newline at end of file
@@ -1,9 +1,12 @@
 #pragma once
 
-#include "game/world/block/block_ptr/block_ptr.h"
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/generation/utilities/noise/hash_noise.h"
+#include "game/world/world/world_config.h"
 
 namespace					game
 {
+	class					structure_writer;
 	class					tree_builder;
 }
 
@@ -11,11 +14,14 @@ class						game::tree_builder
 {
 public :
 
-	static void				build(const block_ptr &block);
+	explicit				tree_builder(const world_config &config);
+
+	// Leaves may stick out of chunk, writer defers them to neighbor chunks
+	void					build(structure_writer &writer, const chunk::index &root) const;
 
 private :
 
 	static const inline int	tree_height = 7;
 
-	static void				validate_leave_block(const block_ptr &block);
-};
+	hash_noise				random;
+};
\ No newline at end of file
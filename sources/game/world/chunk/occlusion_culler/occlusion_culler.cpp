@@ -0,0 +1,159 @@
+#include "occlusion_culler.h"
+
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+
+using namespace				game;
+
+void						occlusion_culler::update(const chunk_map &chunks, const vec3 &camera_position)
+{
+	const auto				start_time = engine::clock::now();
+	const auto				start_chunk_position = vec3
+	(
+		floor(camera_position.x / chunk_settings::size_as_vector.x) * chunk_settings::size_as_vector.x,
+		0.f,
+		floor(camera_position.z / chunk_settings::size_as_vector.z) * chunk_settings::size_as_vector.z
+	);
+	const auto				start_section = (int)floor(camera_position.y / (float)chunk_settings::section_height);
+	const auto				start_chunk = chunks.find(start_chunk_position);
+
+	queue<node>				nodes;
+
+	visible_chunks.clear();
+	visited_sections.clear();
+	number_of_visited_sections = 0;
+
+	// Culling is disabled, when camera is outside of generated world
+	is_enabled =
+	(
+		start_chunk != nullptr and
+		start_section >= 0 and
+		start_section < chunk_settings::number_of_sections
+	);
+
+	if (is_enabled)
+	{
+		visit(start_chunk, start_section);
+		nodes.push({start_chunk, start_section, nullopt, 0});
+	}
+
+	while (not nodes.empty())
+	{
+		const auto			current = nodes.front();
+		const auto			connectivity = current.chunk->get_connectivity(current.section);
+
+		nodes.pop();
+		visible_chunks.insert(current.chunk.get());
+
+		for (auto face : get_all_block_faces())
+		{
+			shared_ptr<chunk>	neighbor_chunk = current.chunk;
+			int					neighbor_section = current.section;
+
+			// Walking back is never needed, as anything behind was already reached from the other side
+			if (current.directions & get_direction_bit(get_opposite(face)))
+				continue ;
+			if (current.entrance and not connectivity.are_connected(*current.entrance, face))
+				continue ;
+
+			if (face == block_face::top)
+				neighbor_section++;
+			else if (face == block_face::bottom)
+				neighbor_section--;
+			else
+				neighbor_chunk = chunks.find(current.chunk->get_position() + get_offset(face));
+
+			if (neighbor_chunk == nullptr)
+				continue ;
+			if (neighbor_section < 0 or neighbor_section >= chunk_settings::number_of_sections)
+				continue ;
+			if (not visit(neighbor_chunk, neighbor_section))
+				continue ;
+
+			nodes.push({neighbor_chunk, neighbor_section, get_opposite(face), current.directions | get_direction_bit(face)});
+		}
+	}
+
+	time = engine::clock::get_seconds_since(start_time);
+}
+
+bool						occlusion_culler::is_visible(const shared_ptr<chunk> &chunk) const
+{
+	return not is_enabled or visible_chunks.count(chunk.get()) > 0;
+}
+
+int							occlusion_culler::get_number_of_visited_sections() const
+{
+	return number_of_visited_sections;
+}
+
+float						occlusion_culler::get_time() const
+{
+	return time;
+}
+
+bool						occlusion_culler::visit(const shared_ptr<chunk> &chunk, int section)
+{
+	auto					&sections = visited_sections[chunk.get()];
+	const auto				bit = 1u << (unsigned)section;
+
+	if (sections & bit)
+		return false;
+
+	sections |= bit;
+	number_of_visited_sections++;
+	return true;
+}
+
+block_face					occlusion_culler::get_opposite(block_face face)
+{
+	switch (face)
+	{
+		case block_face::left :
+			return block_face::right;
+
+		case block_face::right :
+			return block_face::left;
+
+		case block_face::front :
+			return block_face::back;
+
+		case block_face::back :
+			return block_face::front;
+
+		case block_face::top :
+			return block_face::bottom;
+
+		case block_face::bottom :
+			return block_face::top;
+	}
+
+	return face;
+}
+
+unsigned					occlusion_culler::get_direction_bit(block_face face)
+{
+	return 1u << (unsigned)face;
+}
+
+vec3						occlusion_culler::get_offset(block_face face)
+{
+	switch (face)
+	{
+		case block_face::left :
+			return chunk::left_offset;
+
+		case block_face::right :
+			return chunk::right_offset;
+
+		case block_face::front :
+			return chunk::forward_offset;
+
+		case block_face::back :
+			return chunk::back_offset;
+
+		default :
+			return vec3(0.f);
+	}
+}
\ No newline at end of file
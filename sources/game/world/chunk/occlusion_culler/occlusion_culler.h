@@ -0,0 +1,52 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+#include "game/world/block/block_face/block_face.h"
+#include "game/world/chunk/chunk_map/chunk_map.h"
+
+namespace							game
+{
+	class							chunk;
+	class							occlusion_culler;
+}
+
+// Finds chunks, that can be seen from camera, by walking through connected faces of chunk sections
+class								game::occlusion_culler
+{
+public :
+									occlusion_culler() = default;
+									~occlusion_culler() = default;
+
+	void							update(const chunk_map &chunks, const vec3 &camera_position);
+
+	bool							is_visible(const shared_ptr<chunk> &chunk) const;
+
+	int								get_number_of_visited_sections() const;
+	float							get_time() const;
+
+private :
+
+	struct							node
+	{
+		shared_ptr<chunk>			chunk;
+		int							section;
+		optional<block_face>		entrance;
+		unsigned					directions;
+	};
+
+	bool							is_enabled = false;
+	unordered_set<const chunk *>	visible_chunks;
+	unordered_map<const chunk *, unsigned>
+									visited_sections;
+
+	int								number_of_visited_sections = 0;
+	float							time = 0.f;
+
+	bool							visit(const shared_ptr<chunk> &chunk, int section);
+
+	static block_face				get_opposite(block_face face);
+	static unsigned					get_direction_bit(block_face face);
+	static vec3						get_offset(block_face face);
+};
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "application/common/imports/std.h"
+
+#include "game/world/block/block_face/block_face.h"
+
+namespace				game
+{
+	class				section_connectivity;
+}
+
+// 6x6 bitmask, that tells which faces of chunk section can be seen from each other
+class					game::section_connectivity
+{
+public :
+						section_connectivity() = default;
+						~section_connectivity() = default;
+
+	static
+	section_connectivity
+						all()
+	{
+		section_connectivity	result;
+
+		result.mask = (1ull << 36u) - 1;
+		return result;
+	}
+
+	void				connect(block_face first, block_face second)
+	{
+		mask |= get_bit(first, second) | get_bit(second, first);
+	}
+
+	bool				are_connected(block_face first, block_face second) const
+	{
+		return (mask & get_bit(first, second)) != 0;
+	}
+
+private :
+
+	unsigned long long	mask = 0;
+
+	static
+	unsigned long long	get_bit(block_face first, block_face second)
+	{
+		return 1ull << (unsigned)((int)first * 6 + (int)second);
+	}
+};
\ No newline at end of file
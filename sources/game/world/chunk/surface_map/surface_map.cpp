@@ -0,0 +1,50 @@
+#include "surface_map.h"
+
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+
+using namespace					game;
+
+int								surface_map::get_biome_id(int x, int z) const
+{
+	return biome_ids[get_offset(x, z)];
+}
+
+shared_ptr<biomes::abstract>	surface_map::get_biome(int x, int z) const
+{
+	return biome_generator::get_biome(get_biome_id(x, z));
+}
+
+int								surface_map::get_raw_height(int x, int z) const
+{
+	return raw_heights[get_offset(x, z)];
+}
+
+int								surface_map::get_interpolated_height(int x, int z) const
+{
+	return interpolated_heights[get_offset(x, z)];
+}
+
+int								surface_map::get_final_height(int x, int z) const
+{
+	return final_heights[get_offset(x, z)];
+}
+
+bool							surface_map::is_height_affected_by_cave(int x, int z) const
+{
+	return get_final_height(x, z) != get_interpolated_height(x, z);
+}
+
+void							surface_map::set_column(int x, int z, int biome_id, int raw_height, int interpolated_height)
+{
+	const int					offset = get_offset(x, z);
+
+	biome_ids[offset] = (uint8_t)biome_id;
+	raw_heights[offset] = (int16_t)raw_height;
+	interpolated_heights[offset] = (int16_t)interpolated_height;
+	final_heights[offset] = (int16_t)interpolated_height;
+}
+
+void							surface_map::set_final_height(int x, int z, int final_height)
+{
+	final_heights[get_offset(x, z)] = (int16_t)final_height;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "game/world/chunk/chunk/chunk_settings.h"
+
+#include "application/common/imports/std.h"
+
+namespace							game::biomes
+{
+	class							abstract;
+}
+
+namespace							game
+{
+	class							surface_map;
+}
+
+// Per-column surface data of chunk, produced once by surface generation stage and read by later stages.
+// Biome is stored as id and heights as 16-bit integers, so whole map takes 7 bytes per column.
+class								game::surface_map
+{
+public :
+
+	static constexpr int			size_x = chunk_settings::size[0];
+	static constexpr int			size_z = chunk_settings::size[2];
+
+									surface_map() = default;
+									~surface_map() = default;
+
+	int								get_biome_id(int x, int z) const;
+	shared_ptr<biomes::abstract>	get_biome(int x, int z) const;
+
+	// Height of column's own biome, before interpolation with neighbors
+	int								get_raw_height(int x, int z) const;
+	int								get_interpolated_height(int x, int z) const;
+
+	// Height of highest non-air block after caves are carved, available after landscape stage
+	int								get_final_height(int x, int z) const;
+	bool							is_height_affected_by_cave(int x, int z) const;
+
+	void							set_column(int x, int z, int biome_id, int raw_height, int interpolated_height);
+	void							set_final_height(int x, int z, int final_height);
+
+private :
+
+	static constexpr int			area = size_x * size_z;
+
+	array<uint8_t, area>			biome_ids = {};
+	array<int16_t, area>			raw_heights = {};
+	array<int16_t, area>			interpolated_heights = {};
+	array<int16_t, area>			final_heights = {};
+
+	static int						get_offset(int x, int z)
+	{
+		return x * size_z + z;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include "far_chunk.h"
+
+#include "engine/main/rendering/model/model/model.h"
+
+#include "game/world/block/block/block_settings.h"
+#include "game/world/chunk/chunk/chunk_settings.h"
+#include "game/world/chunk/generation/utilities/biome/biome_generator/biome_generator.h"
+#include "game/world/chunk/generation/utilities/height_interpolator/height_interpolator.h"
+#include "game/world/texture_atlas/texture_atlas/texture_atlas.h"
+#include "game/world/far_terrain/far_terrain/far_terrain.h"
+#include "game/world/far_terrain/far_terrain/far_terrain_settings.h"
+
+using namespace				game;
+
+							far_chunk::far_chunk(const vec3 &position, int level) :
+								position(position),
+								center(position + chunk_settings::size_as_vector / 2.f),
+								level(level)
+{}
+
+vec3						far_chunk::get_position() const
+{
+	return position;
+}
+
+vec3						far_chunk::get_center() const
+{
+	return center;
+}
+
+int							far_chunk::get_level() const
+{
+	return level;
+}
+
+shared_ptr<engine::model>	far_chunk::get_model() const
+{
+	return model;
+}
+
+bool						far_chunk::is_busy() const
+{
+	return future and future->wait_for(chrono::seconds(0)) != future_status::ready;
+}
+
+bool						far_chunk::is_generated() const
+{
+	return future and not is_busy();
+}
+
+bool						far_chunk::is_built() const
+{
+	return model != nullptr;
+}
+
+void						far_chunk::launch()
+{
+	future = async(launch::async, [this](){ generate(); });
+}
+
+void						far_chunk::build()
+{
+	model = make_shared<engine::model>();
+
+	model->set_translation(position);
+	model->use(true);
+
+	model->add_vbo(3, vertices);
+	model->add_vbo(2, texture_coordinates);
+	model->add_vbo(1, light_levels);
+	model->add_ebo(indices);
+
+	model->use(false);
+
+	vertices = {};
+	texture_coordinates = {};
+	light_levels = {};
+	indices = {};
+}
+
+void						far_chunk::generate()
+{
+	const auto				start = engine::clock::now();
+
+	const int				step = far_terrain_settings::steps[level];
+	const int				number_of_cells = chunk_settings::size[0] / step;
+
+	// Columns are sampled with a border of one cell, so sides facing neighbor chunks can be built too
+	const int				number_of_columns = number_of_cells + 2;
+	vector<column>			columns(number_of_columns * number_of_columns);
+
+	const auto				find_column = [&columns, number_of_columns](int x, int z) -> column &
+	{
+		return columns[(x + 1) * number_of_columns + (z + 1)];
+	};
+
+	for (int x = -1; x <= number_of_cells; x++)
+	for (int z = -1; z <= number_of_cells; z++)
+		find_column(x, z) = generate_column(vec2(position.x + (float)(x * step), position.z + (float)(z * step)));
+
+	for (int x = 0; x < number_of_cells; x++)
+	for (int z = 0; z < number_of_cells; z++)
+	{
+		const auto			&this_column = find_column(x, z);
+
+		const float			min_x = (float)(x * step);
+		const float			max_x = (float)((x + 1) * step);
+		const float			min_z = (float)(z * step);
+		const float			max_z = (float)((z + 1) * step);
+		const float			top = (float)(this_column.height + 1);
+
+		generate_quad
+		(
+			{vec3(min_x, top, max_z), vec3(max_x, top, max_z), vec3(max_x, top, min_z), vec3(min_x, top, min_z)},
+			texture_atlas::get_rectangle(this_column.type, block_face::top),
+			block_settings::sun_light_level
+		);
+
+		const auto			generate_side = [&](int neighbor_x, int neighbor_z, const vec3 &first, const vec3 &second)
+		{
+			const bool		is_border = neighbor_x < 0 or neighbor_z < 0 or neighbor_x >= number_of_cells or neighbor_z >= number_of_cells;
+			float			bottom = (float)(find_column(neighbor_x, neighbor_z).height + 1);
+
+			// Sides on chunk border are extended down as skirts, so cracks between levels are hidden
+			if (is_border)
+				bottom = min(bottom, top) - far_terrain_settings::skirt_depth;
+			else if (bottom >= top)
+				return ;
+
+			generate_quad
+			(
+				{vec3(first.x, top, first.z), vec3(second.x, top, second.z), vec3(second.x, bottom, second.z), vec3(first.x, bottom, first.z)},
+				texture_atlas::get_rectangle(this_column.type, block_face::front),
+				block_settings::default_light_level
+			);
+		};
+
+		generate_side(x - 1, z, vec3(min_x, 0.f, min_z), vec3(min_x, 0.f, max_z));
+		generate_side(x + 1, z, vec3(max_x, 0.f, max_z), vec3(max_x, 0.f, min_z));
+		generate_side(x, z - 1, vec3(max_x, 0.f, min_z), vec3(min_x, 0.f, min_z));
+		generate_side(x, z + 1, vec3(min_x, 0.f, max_z), vec3(max_x, 0.f, max_z));
+	}
+
+	far_terrain::register_generation_time(level, engine::clock::now() - start);
+}
+
+far_chunk::column			far_chunk::generate_column(const vec2 &position) const
+{
+	static const auto		height_generator = [](const vec2 &position)
+	{
+		return biome_generator::generate_biome(position)->generate_height(position);
+	};
+
+	const auto				biome = biome_generator::generate_biome(position);
+
+	column					column;
+	int						water_height;
+
+	column.height = height_interpolator(height_generator)(position);
+	column.type = biome->generate_block(column.height, column.height, false, false);
+
+	// Water surface is found the same way, as landscape task fills columns from top to bottom
+	water_height = column.height + 1;
+	while (water_height < chunk_settings::size[1] and biome->generate_block(water_height, column.height, false, false) == block_type::water)
+		water_height++;
+
+	if (water_height != column.height + 1)
+	{
+		column.height = water_height - 1;
+		column.type = block_type::water;
+	}
+
+	return column;
+}
+
+void						far_chunk::generate_quad
+							(
+								const array<vec3, 4> &corners,
+								const texture_atlas::rectangle &texture,
+								float light_level
+							)
+{
+	static const float		epsilon = 0.005f;
+	static const vec2		local_texture_coordinates[4] =
+	{
+		vec2(0.f + epsilon, 1.f - epsilon),
+		vec2(1.f - epsilon, 1.f - epsilon),
+		vec2(1.f - epsilon, 0.f + epsilon),
+		vec2(0.f + epsilon, 0.f + epsilon)
+	};
+
+	const auto				offset = (GLuint)(vertices.size() / 3);
+
+	for (int i = 0; i < 4; i++)
+	{
+		vertices.push_back(corners[i].x);
+		vertices.push_back(corners[i].y);
+		vertices.push_back(corners[i].z);
+
+		texture_coordinates.push_back(mix(texture.min.x, texture.max.x, local_texture_coordinates[i].x));
+		texture_coordinates.push_back(mix(texture.min.y, texture.max.y, local_texture_coordinates[i].y));
+
+		light_levels.push_back(light_level);
+	}
+
+	for (GLuint index : {0u, 1u, 3u, 1u, 2u, 3u})
+		indices.push_back(offset + index);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "application/common/imports/opengl.h"
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+#include "game/world/block/block_type/block_type/block_type.h"
+#include "game/world/texture_atlas/texture_atlas/texture_atlas.h"
+
+namespace						engine
+{
+	class						model;
+}
+
+namespace						game
+{
+	class						far_chunk;
+}
+
+// Heightmap-only chunk, that skips caves, decorations and light and has only surface geometry
+class							game::far_chunk
+{
+public :
+								far_chunk(const vec3 &position, int level);
+								~far_chunk() = default;
+
+	vec3						get_position() const;
+	vec3						get_center() const;
+	int							get_level() const;
+
+	shared_ptr<engine::model>	get_model() const;
+
+	bool						is_busy() const;
+	bool						is_generated() const;
+	bool						is_built() const;
+
+	void						launch();
+	void						build();
+
+private :
+
+	const vec3					position;
+	const vec3					center;
+	const int					level;
+
+	optional<future<void>>		future;
+	shared_ptr<engine::model>	model;
+
+	vector<float>				vertices;
+	vector<float>				texture_coordinates;
+	vector<float>				light_levels;
+	vector<GLuint>				indices;
+
+	struct						column
+	{
+		int						height;
+		block_type				type;
+	};
+
+	void						generate();
+
+	column						generate_column(const vec2 &position) const;
+
+	void						generate_quad
+								(
+									const array<vec3, 4> &corners,
+									const texture_atlas::rectangle &texture,
+									float light_level
+								);
+};
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "far_terrain.h"
+
+#include "game/world/chunk/chunk/chunk.h"
+#include "game/world/chunk/chunk_renderer/chunk_renderer.h"
+#include "game/world/world/world_settings.h"
+
+using namespace			game;
+
+void					far_terrain::update(const vec3 &pivot)
+{
+	const auto			start = engine::clock::now();
+	const auto			pivot_chunk = vec3
+	(
+		floor(pivot.x / chunk_settings::size_as_vector.x) * chunk_settings::size_as_vector.x,
+		0.f,
+		floor(pivot.z / chunk_settings::size_as_vector.z) * chunk_settings::size_as_vector.z
+	);
+
+	this->pivot = pivot;
+
+	build_generated_chunks();
+	release_dropped_chunks();
+
+	if (last_pivot_chunk != pivot_chunk)
+	{
+		last_pivot_chunk = pivot_chunk;
+		rescan();
+	}
+
+	launch_pending_chunks();
+
+	update_time += engine::clock::now() - start;
+}
+
+void					far_terrain::enqueue(const chunk_map &chunks) const
+{
+	for (const auto &[position, far_chunk] : this->chunks)
+	{
+		if (not far_chunk->is_built())
+			continue ;
+
+		// Far chunk is hidden as soon as full chunk at the same place can be rendered
+		if (auto chunk = chunks.find(position); chunk != nullptr and chunk->is_renderable())
+			continue ;
+
+		chunk_renderer::enqueue(far_chunk->get_model(), chunk_renderer::group::opaque);
+	}
+}
+
+void					far_terrain::register_generation_time(int level, engine::clock::ticks time)
+{
+	generation_time_in_nanoseconds[level] += time;
+	number_of_generations[level]++;
+}
+
+float					far_terrain::get_average_generation_time(int level)
+{
+	const int			number = number_of_generations[level];
+
+	if (number == 0)
+		return 0.f;
+	return (float)generation_time_in_nanoseconds[level] / (float)number / 1e6f;
+}
+
+engine::clock::ticks	far_terrain::get_generation_time(int level)
+{
+	return generation_time_in_nanoseconds[level];
+}
+
+int						far_terrain::get_number_of_generations(int level)
+{
+	return number_of_generations[level];
+}
+
+engine::clock::ticks	far_terrain::get_update_time()
+{
+	return update_time;
+}
+
+optional<int>			far_terrain::find_level(const vec3 &position) const
+{
+	const float			distance = this->distance(position);
+	const float			visibility_limit = world_settings::visibility_limit[world_settings::current_visibility_option];
+
+	if (distance < visibility_limit - far_terrain_settings::overlap)
+		return nullopt;
+
+	for (int level = 0; level < far_terrain_settings::number_of_levels; level++)
+	{
+		if (distance < far_terrain_settings::level_limits[level])
+			return level;
+	}
+
+	return nullopt;
+}
+
+float					far_terrain::distance(const vec3 &position) const
+{
+	// Same metric as world uses, so the inner edge of far terrain matches visibility of full chunks
+	return glm::distance(pivot, position + chunk_settings::size_as_vector / 2.f);
+}
+
+void					far_terrain::build_generated_chunks()
+{
+	for (const auto &[position, far_chunk] : chunks)
+	{
+		if (far_chunk->is_generated() and not far_chunk->is_built())
+			far_chunk->build();
+	}
+}
+
+void					far_terrain::release_dropped_chunks()
+{
+	dropped_chunks.remove_if([](const shared_ptr<far_chunk> &far_chunk){ return not far_chunk->is_busy(); });
+}
+
+void					far_terrain::rescan()
+{
+	const int			radius = (int)(far_terrain_settings::level_limits.back() / chunk_settings::size_as_vector.x) + 1;
+
+	for (auto iterator = chunks.begin(); iterator != chunks.end();)
+	{
+		if (find_level(iterator->first) != iterator->second->get_level())
+		{
+			dropped_chunks.push_back(iterator->second);
+			iterator = chunks.erase(iterator);
+		}
+		else
+			iterator++;
+	}
+
+	pending_positions.clear();
+
+	for (int x = -radius; x <= radius; x++)
+	for (int z = -radius; z <= radius; z++)
+	{
+		const auto		position = *last_pivot_chunk + vec3(x, 0, z) * chunk_settings::size_as_vector;
+
+		if (find_level(position) and chunks.find(position) == chunks.end())
+			pending_positions.push_back(position);
+	}
+
+	// Nearest positions are at the back, so they are launched first
+	sort
+	(
+		pending_positions.begin(),
+		pending_positions.end(),
+		[this](const vec3 &left, const vec3 &right)
+		{
+			return distance(left) > distance(right);
+		}
+	);
+}
+
+void					far_terrain::launch_pending_chunks()
+{
+	int					number_of_busy_chunks = (int)dropped_chunks.size();
+
+	for (const auto &[position, far_chunk] : chunks)
+		number_of_busy_chunks += far_chunk->is_busy();
+
+	while (number_of_busy_chunks < far_terrain_settings::max_chunks_in_generation and not pending_positions.empty())
+	{
+		const auto		position = pending_positions.back();
+		const auto		level = find_level(position);
+
+		pending_positions.pop_back();
+
+		if (not level)
+			continue ;
+
+		const auto		far_chunk = make_shared<game::far_chunk>(position, *level);
+
+		far_chunk->launch();
+		chunks.emplace(position, far_chunk);
+		number_of_busy_chunks++;
+	}
+}
\ No newline at end of file
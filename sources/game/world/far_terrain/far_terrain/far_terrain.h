@@ -0,0 +1,65 @@
+#pragma once
+
+#include "application/common/imports/glm.h"
+#include "application/common/imports/std.h"
+
+#include "engine/main/system/time/clock/clock.h"
+
+#include "game/world/chunk/chunk_map/chunk_map.h"
+#include "game/world/far_terrain/far_chunk/far_chunk.h"
+#include "game/world/far_terrain/far_terrain/far_terrain_settings.h"
+
+namespace								game
+{
+	class								far_terrain;
+}
+
+// Ring of far chunks, that is placed beyond full chunks and fills the gaps, while full chunks are generated
+class									game::far_terrain
+{
+public :
+										far_terrain() = default;
+										~far_terrain() = default;
+
+	void								update(const vec3 &pivot);
+	void								enqueue(const chunk_map &chunks) const;
+
+	static void							register_generation_time(int level, engine::clock::ticks time);
+	static float						get_average_generation_time(int level);
+
+	// Totals since start, so cost of some interval is difference of values at its ends.
+	// Generation runs on own threads of far chunks, update (including building of models) runs on main thread.
+	static engine::clock::ticks			get_generation_time(int level);
+	static int							get_number_of_generations(int level);
+	static engine::clock::ticks			get_update_time();
+
+private :
+
+	using								map_type = unordered_map<vec3, shared_ptr<far_chunk>, vec3_hasher>;
+
+	map_type							chunks;
+	list<shared_ptr<far_chunk>>			dropped_chunks;
+	vector<vec3>						pending_positions;
+
+	vec3								pivot;
+	optional<vec3>						last_pivot_chunk;
+
+	static inline
+	array<atomic<long long>, far_terrain_settings::number_of_levels>
+										generation_time_in_nanoseconds = {};
+
+	static inline
+	array<atomic<int>, far_terrain_settings::number_of_levels>
+										number_of_generations = {};
+
+	static inline
+	engine::clock::ticks				update_time = 0;
+
+	optional<int>						find_level(const vec3 &position) const;
+	float								distance(const vec3 &position) const;
+
+	void								build_generated_chunks();
+	void								release_dropped_chunks();
+	void								rescan();
+	void								launch_pending_chunks();
+};
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "application/common/defines.h"
+
+namespace								game
+{
+	struct								far_terrain_settings;
+}
+
+struct									game::far_terrain_settings
+{
+	// Can be switched at runtime, but only if far terrain is compiled in
+	static inline bool					is_enabled = FT_VOX_FAR_TERRAIN;
+
+	static constexpr int				number_of_levels = 3;
+
+	// Each level samples the surface every N blocks
+	static constexpr int				steps[number_of_levels] = {2, 4, 8};
+
+	// Upper distance of each level, last one is the view distance of far terrain
+	static inline array<float, number_of_levels>
+										level_limits = { 450.f, 575.f, 700.f };
+
+	// Far chunks start a bit before full chunks end, so there are no gaps between them
+	static inline float					overlap = 32.f;
+
+	static constexpr float				skirt_depth = 8.f;
+	static constexpr int				max_chunks_in_generation = 4;
+};
\ No newline at end of file
@@ -33,36 +33,40 @@ vec2						texture_atlas::get_texture_size()
 
 game::texture_coordinates	&texture_atlas::get_coordinates(block_type type)
 {
-	const auto 				instance = texture_atlas::get_instance();
+	const auto 				instance = get_instance();
 
-	if (not instance->contains(type))
-		instance->add(type);
+	debug::check_critical(not instance->frozen, "[texture_atlas] Can't change coordinates of frozen atlas");
 
-	return instance->get(type);
+	return instance->coordinates[(int)type];
 }
 
-void						texture_atlas::use(bool state)
+void						texture_atlas::freeze()
 {
-	get_instance()->texture->use(state);
-}
+	const auto 				instance = get_instance();
+	const vec2				size = get_texture_size();
 
-bool						texture_atlas::contains(block_type type) const
-{
-	shared_lock				lock(mutex);
+	for (int type = 0; type < number_of_types; type++)
+	for (const auto face : get_all_block_faces())
+	{
+		const vec2			min = size * vec2(instance->coordinates[type].get(face));
+
+		instance->rectangles[type][(int)face] = {min, min + size};
+	}
 
-	return map.find(type) != map.end();
+	instance->frozen = true;
 }
 
-game::texture_coordinates	&texture_atlas::get(block_type type)
+bool						texture_atlas::is_frozen()
 {
-	shared_lock				lock(mutex);
-
-	return map.at(type);
+	return get_instance()->frozen;
 }
 
-void 						texture_atlas::add(block_type type)
+const texture_atlas::rectangle	&texture_atlas::get_rectangle(block_type type, block_face face)
 {
-	unique_lock				lock(mutex);
+	return get_instance()->rectangles[(int)type][(int)face];
+}
 
-	map.try_emplace(type);
+void						texture_atlas::use(bool state)
+{
+	get_instance()->texture->use(state);
 }
\ No newline at end of file
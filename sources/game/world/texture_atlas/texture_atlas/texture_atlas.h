@@ -8,6 +8,7 @@
 #include "engine/main/rendering/texture/texture/texture.h"
 
 #include "game/world/block/block/block.h"
+#include "game/world/block/block_face/block_face.h"
 #include "game/world/texture_atlas/texture_coordinates/texture_coordinates.h"
 
 namespace							game
@@ -20,26 +21,44 @@ namespace							game
 class								game::texture_atlas : public singleton<texture_atlas>
 {
 public :
+
+	// Part of atlas in UV space, that is used by one face of one block type
+	struct							rectangle
+	{
+		vec2						min = vec2(0.f);
+		vec2						max = vec2(0.f);
+	};
+
+	static constexpr int			number_of_types = (int)block_type::blue_flower + 1;
+	static constexpr int			number_of_faces = (int)block_face::bottom + 1;
+
 									texture_atlas();
 									~texture_atlas() override = default;
 
 	static vec2 					get_texture_size();
+
+	// Coordinates can be changed only during setup, before atlas is frozen
 	static texture_coordinates		&get_coordinates(block_type type);
 
+	// Precomputes rectangles for every type and face, after that atlas is read-only,
+	// so generation threads read it without any locks
+	static void						freeze();
+	static bool						is_frozen();
+
+	static const rectangle			&get_rectangle(block_type type, block_face face);
+
 	static void 					use(bool state);
 
 private :
 
-	using 							map_type = map<block_type, texture_coordinates>;
-
 	static inline constexpr int		texture_size_in_pixels[2] = {48, 48};
 
 	shared_ptr<engine::texture>		texture;
 	ivec2 							number_of_textures = ivec2(0);
-	map_type						map;
-	mutable shared_mutex			mutex;
 
-	bool							contains(block_type type) const;
-	game::texture_coordinates		&get(block_type type);
-	void 							add(block_type type);
+	array<texture_coordinates, number_of_types>
+									coordinates;
+	array<array<rectangle, number_of_faces>, number_of_types>
+									rectangles;
+	bool							frozen = false;
 };
\ No newline at end of file
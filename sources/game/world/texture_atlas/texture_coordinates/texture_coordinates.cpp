@@ -78,4 +78,30 @@ ivec2 				texture_coordinates::get_back() const
 ivec2 				texture_coordinates::get_front() const
 {
 	return _front;
+}
+
+ivec2 				texture_coordinates::get(block_face face) const
+{
+	switch (face)
+	{
+		case block_face::left:
+			return _left;
+
+		case block_face::right:
+			return _right;
+
+		case block_face::front:
+			return _front;
+
+		case block_face::back:
+			return _back;
+
+		case block_face::top:
+			return _top;
+
+		case block_face::bottom:
+			return _bottom;
+	}
+
+	return ivec2(0);
 }
\ No newline at end of file
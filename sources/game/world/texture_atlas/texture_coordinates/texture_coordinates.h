@@ -2,6 +2,8 @@
 
 #include "application/common/imports/glm.h"
 
+#include "game/world/block/block_face/block_face.h"
+
 namespace				game
 {
 	class				texture_coordinates;
@@ -29,6 +31,8 @@ public :
 	ivec2 				get_back() const;
 	ivec2 				get_front() const;
 
+	ivec2 				get(block_face face) const;
+
 private :
 
 	ivec2 				_left;
@@ -11,6 +11,14 @@ namespace			game
 class 				game::aabb
 {
 public :
+
+	struct			contact
+	{
+		// Fraction of offset after which boxes start touching
+		float		time;
+		vec3		normal;
+	};
+
 					aabb(const vec3 &min, const vec3 &max) : min(min), max(max) {}
 					~aabb() = default;
 
@@ -22,6 +30,56 @@ public :
 			and first.min.z <= second.max.z and first.max.z >= second.min.z);
 	}
 
+	// Moves first box by offset, returns earliest contact with second box or nothing if boxes don't meet.
+	// Boxes that overlap already at start are ignored, so it's possible to move out of them.
+	static optional<contact>
+					sweep(const aabb &moving, const vec3 &offset, const aabb &obstacle)
+	{
+		float		entry_time = -numeric_limits<float>::infinity();
+		float		exit_time = numeric_limits<float>::infinity();
+		int			entry_axis = -1;
+
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float	axis_entry_time;
+			float	axis_exit_time;
+
+			if (offset[axis] > 0.f)
+			{
+				axis_entry_time = (obstacle.min[axis] - moving.max[axis]) / offset[axis];
+				axis_exit_time = (obstacle.max[axis] - moving.min[axis]) / offset[axis];
+			}
+			else if (offset[axis] < 0.f)
+			{
+				axis_entry_time = (obstacle.max[axis] - moving.min[axis]) / offset[axis];
+				axis_exit_time = (obstacle.min[axis] - moving.max[axis]) / offset[axis];
+			}
+			else if (moving.max[axis] > obstacle.min[axis] and moving.min[axis] < obstacle.max[axis])
+				continue ;
+			else
+				return nullopt;
+
+			if (axis_entry_time > entry_time)
+			{
+				entry_time = axis_entry_time;
+				entry_axis = axis;
+			}
+
+			exit_time = std::min(exit_time, axis_exit_time);
+		}
+
+		if (entry_axis == -1 or entry_time < 0.f or entry_time > 1.f or entry_time >= exit_time)
+			return nullopt;
+
+		contact		result;
+
+		result.time = entry_time;
+		result.normal = vec3(0.f);
+		result.normal[entry_axis] = offset[entry_axis] > 0.f ? -1.f : 1.f;
+
+		return result;
+	}
+
 	const vec3		min;
 	const vec3		max;
 };
\ No newline at end of file
@@ -4,16 +4,26 @@
 
 #include "engine/main/rendering/camera/camera/camera.h"
 #include "engine/main/system/input/input.h"
+#include "engine/main/system/time/clock/clock.h"
+#include "engine/main/system/profiler/profiler/profiler.h"
+#include "engine/main/system/profiler/scoped_timer/scoped_timer.h"
 
 #include "game/world/tools/aabb/aabb.h"
 #include "game/world/block/block_highlighter/block_highlighter/block_highlighter.h"
 #include "game/world/chunk/chunk/chunk.h"
 #include "game/world/chunk/chunk_renderer/chunk_renderer.h"
+#include "game/world/chunk/chunk_cache/chunk_cache.h"
+#include "game/world/chunk/generation/chunk_generation_budget/chunk_generation_budget.h"
 
 using namespace				engine;
 using namespace				game;
 
-							world::world() : pivot(0, 0, 0)
+							world::world() :
+								pivot(0, 0, 0),
+								should_sort_chunks(true),
+								sorting_time(0.f),
+								number_of_rendered_chunks(0),
+								number_of_renderable_chunks(0)
 {
 	set_layout("Opaque");
 }
@@ -81,43 +91,199 @@ float						world::distance(const shared_ptr<chunk> &chunk)
 
 bool						world::does_collide(const aabb &aabb)
 {
-	vec3 					min = floor(aabb.min);
-	vec3 					max = floor(aabb.max);
+	const vec3				margin = vec3(world_settings::collision_margin);
+	const ivec3				min = ivec3(floor(aabb.min - margin));
+	const ivec3				max = ivec3(floor(aabb.max + margin));
 
-	block_ptr				block_iterator;
+	chunk_cache				cache(get_instance()->chunks, min, max);
 
-	for (int x = (int)min.x; x <= (int)max.x; x++)
-	for (int y = (int)min.y; y <= (int)max.y; y++)
-	for (int z = (int)min.z; z <= (int)max.z; z++)
+	for (int x = min.x; x <= max.x; x++)
+	for (int y = min.y; y <= max.y; y++)
+	for (int z = min.z; z <= max.z; z++)
 	{
-		if (block_iterator = find_block(vec3(x, y, z)); not block_iterator)
-			continue ;
-
-		if
-		(
-			is_solid(get_meta_type(block_iterator->get_type())) and
-			aabb::do_collide(aabb, block_iterator.get_aabb())
-		)
-		{
+		if (cache.is_solid(ivec3(x, y, z)))
 			return true;
-		}
 	}
 
 	return false;
 }
 
+optional<aabb::contact>		world::sweep(const aabb &aabb, const vec3 &offset)
+{
+	const vec3				margin = vec3(world_settings::collision_margin);
+	const game::aabb		moving(aabb.min - margin, aabb.max + margin);
+
+	// Broad phase covers box both at start and at end of movement
+	const ivec3				min = ivec3(floor(glm::min(moving.min, moving.min + offset)));
+	const ivec3				max = ivec3(floor(glm::max(moving.max, moving.max + offset)));
+
+	chunk_cache				cache(get_instance()->chunks, min, max);
+	optional<aabb::contact>	result;
+
+	for (int x = min.x; x <= max.x; x++)
+	for (int y = min.y; y <= max.y; y++)
+	for (int z = min.z; z <= max.z; z++)
+	{
+		if (not cache.is_solid(ivec3(x, y, z)))
+			continue ;
+
+		const game::aabb	block(vec3(x, y, z), vec3(x + 1, y + 1, z + 1));
+
+		if (auto contact = aabb::sweep(moving, offset, block); contact and (not result or contact->time < result->time))
+			result = contact;
+	}
+
+	if (result)
+	{
+		const float			distance_along_normal = glm::abs(dot(offset, result->normal));
+
+		result->time = std::max(0.f, result->time - world_settings::collision_skin / distance_along_normal);
+	}
+
+	return result;
+}
+
+float						world::get_sorting_time()
+{
+	return get_instance()->sorting_time;
+}
+
+int							world::get_number_of_rendered_chunks()
+{
+	return get_instance()->number_of_rendered_chunks;
+}
+
+int							world::get_number_of_renderable_chunks()
+{
+	return get_instance()->number_of_renderable_chunks;
+}
+
+int							world::get_number_of_created_chunks()
+{
+	return get_instance()->number_of_created_chunks;
+}
+
+int							world::get_number_of_destroyed_chunks()
+{
+	return get_instance()->number_of_destroyed_chunks;
+}
+
+int							world::get_number_of_chunks()
+{
+	return get_instance()->chunks.get_size();
+}
+
+pair<int, int>				world::get_loading_progress(float radius)
+{
+	const auto				instance = get_instance();
+	const auto				&size = chunk_settings::size_as_vector;
+
+	const int				min_x = (int)floor((instance->pivot.x - radius) / size.x) - 1;
+	const int				max_x = (int)floor((instance->pivot.x + radius) / size.x) + 1;
+	const int				min_z = (int)floor((instance->pivot.z - radius) / size.z) - 1;
+	const int				max_z = (int)floor((instance->pivot.z + radius) / size.z) + 1;
+
+	int						number_of_loaded_chunks = 0;
+	int						number_of_chunks = 0;
+
+	for (int x = min_x; x <= max_x; x++)
+	for (int z = min_z; z <= max_z; z++)
+	{
+		const auto			position = vec3((float)x * size.x, 0.f, (float)z * size.z);
+
+		if (distance(position) >= radius)
+			continue ;
+
+		number_of_chunks++;
+
+		if (auto chunk = instance->chunks.find(position); chunk != nullptr and chunk->is_valid())
+			number_of_loaded_chunks++;
+	}
+
+	return {number_of_loaded_chunks, number_of_chunks};
+}
+
+world::occlusion_sample		world::measure_occlusion(const vec3 &camera_position, int number_of_repetitions)
+{
+	const auto				instance = get_instance();
+
+	occlusion_sample		sample;
+	game::occlusion_culler	culler;
+	float					total_time = 0.f;
+
+	for (int repetition = 0; repetition < number_of_repetitions; repetition++)
+	{
+		culler.update(instance->chunks, camera_position);
+		total_time += culler.get_time();
+	}
+
+	for (const auto &[position, chunk] : instance->chunks)
+	{
+		if (not chunk->is_renderable())
+			continue ;
+
+		sample.renderable_chunks++;
+
+		if (culler.is_visible(chunk))
+			sample.visible_chunks++;
+	}
+
+	sample.visited_sections = culler.get_number_of_visited_sections();
+	sample.time = number_of_repetitions > 0 ? total_time / (float)number_of_repetitions : 0.f;
+
+	return sample;
+}
+
+bool						world::is_ready()
+{
+	return get_instance()->is_warmed_up;
+}
+
+pair<int, int>				world::get_warm_up_progress()
+{
+	return get_loading_progress(get_warm_up_radius());
+}
+
+float						world::get_warm_up_time()
+{
+	return get_instance()->warm_up_time;
+}
+
+float						world::get_warm_up_radius()
+{
+	const int				option = world_settings::current_visibility_option;
+
+	// Edge chunk gets model only after its neighbors are lit, which in turn needs their neighbors decorated,
+	// so two rings of chunks around warm-up area must be within creation limit too
+	const float				chunk_diagonal = glm::length(vec2(chunk_settings::size[0], chunk_settings::size[2]));
+	const float				creation_limit = world_settings::cashing_limit[option] - 2.f * chunk_diagonal;
+
+	return std::min({world_settings::warm_up_radius, world_settings::visibility_limit[option], creation_limit});
+}
+
 void						world::when_initialized()
 {
 	create_chunk(vec3());
+
+	warm_up_start = clock::now();
+	chunk_generation_budget::set_warm_up(true);
 }
 
 void						world::when_updated()
 {
-	engine::timer			timer{ world_settings::chunks_generation_time_limit };
+	static const int		section = engine::profiler::register_section("World update");
+	engine::scoped_timer	profiling_timer(section);
+
+	chunk_generation_budget::update();
+
+	engine::timer			timer{ chunk_generation_budget::get_budget() };
+	int						number_of_processed_chunks = 0;
+	const int				number_of_chunks = chunks.get_size();
 
 	process_input();
 
 	update_pivot();
+	update_warm_up();
 
 	for (const auto &[position, chunk] : chunks)
 	{
@@ -128,26 +294,77 @@ void						world::when_updated()
 		update_chunk_visibility(chunk);
 		create_chunk_neighbors_if_needed(chunk);
 		destroy_chunk_if_needed(chunk);
+
+		number_of_processed_chunks++;
 	}
 
+	chunk_generation_budget::register_backlog(number_of_chunks - number_of_processed_chunks);
+
 	update_chunk_map();
+
+#if FT_VOX_FAR_TERRAIN
+	if (far_terrain_settings::is_enabled)
+		far_terrain.update(pivot);
+#endif
 }
 
 void						world::when_rendered()
 {
+	static const int		section = engine::profiler::register_section("World render");
+	static const int		sorting_section = engine::profiler::register_section("Sorting");
+	static const int		occlusion_section = engine::profiler::register_section("Occlusion");
+
+	engine::scoped_timer	profiling_timer(section);
+
 	if (auto camera_block = find_block(camera::get_position()); camera_block)
 		chunk_renderer::set_apply_water_tint(camera_block->get_type() == block_type::water);
 	else
 		chunk_renderer::set_apply_water_tint(false);
 
-	for (auto [position, chunk] : chunks)
-		chunk_renderer::render(chunk, chunk_renderer::group::opaque);
+	update_sorting();
+	engine::profiler::register_time(sorting_section, sorting_time);
 
-	for (auto [position, chunk] : chunks)
+#if FT_VOX_OCCLUSION_CULLING
+	occlusion_culler.update(chunks, camera::get_position());
+	engine::profiler::register_time(occlusion_section, occlusion_culler.get_time());
+#endif
+
+	visible_chunks.clear();
+	number_of_renderable_chunks = 0;
+
+	for (const auto &chunk : chunks_by_distance)
 	{
-		chunk_renderer::render(chunk, chunk_renderer::group::partially_transparent);
-		chunk_renderer::render(chunk, chunk_renderer::group::transparent);
+		if (not chunk->is_renderable())
+			continue ;
+
+		number_of_renderable_chunks++;
+
+#if FT_VOX_OCCLUSION_CULLING
+		if (not occlusion_culler.is_visible(chunk))
+			continue ;
+#endif
+
+		visible_chunks.push_back(chunk);
+	}
+
+	number_of_rendered_chunks = (int)visible_chunks.size();
+
+	// Opaque chunks go near-to-far for early depth rejection, others go far-to-near for correct blending
+	for (auto iterator = visible_chunks.rbegin(); iterator != visible_chunks.rend(); iterator++)
+		chunk_renderer::enqueue(*iterator, chunk_renderer::group::opaque);
+
+#if FT_VOX_FAR_TERRAIN
+	if (far_terrain_settings::is_enabled)
+		far_terrain.enqueue(chunks);
+#endif
+
+	for (const auto &chunk : visible_chunks)
+	{
+		chunk_renderer::enqueue(chunk, chunk_renderer::group::partially_transparent);
+		chunk_renderer::enqueue(chunk, chunk_renderer::group::transparent);
 	}
+
+	chunk_renderer::render_queue();
 }
 
 void 						world::process_input()
@@ -173,6 +390,98 @@ void						world::update_pivot()
 	pivot.z = camera::get_position().z;
 }
 
+void						world::update_warm_up()
+{
+	if (is_warmed_up)
+		return;
+
+	const float				radius = get_warm_up_radius();
+
+	// All chunks of warm-up area are created at once, instead of growing by one ring of neighbors per frame
+	if (not is_warm_up_area_created)
+	{
+		const auto			&size = chunk_settings::size_as_vector;
+
+		const int			min_x = (int)floor((pivot.x - radius) / size.x) - 1;
+		const int			max_x = (int)floor((pivot.x + radius) / size.x) + 1;
+		const int			min_z = (int)floor((pivot.z - radius) / size.z) - 1;
+		const int			max_z = (int)floor((pivot.z + radius) / size.z) + 1;
+
+		chunks.process_added_chunks();
+
+		for (int x = min_x; x <= max_x; x++)
+		for (int z = min_z; z <= max_z; z++)
+		{
+			const auto		position = vec3((float)x * size.x, 0.f, (float)z * size.z);
+
+			if (distance(position) < radius)
+				create_chunk_if_needed(position);
+		}
+
+		is_warm_up_area_created = true;
+		return;
+	}
+
+	const auto				[number_of_built_chunks, number_of_chunks] = get_loading_progress(radius);
+
+	if (number_of_built_chunks < number_of_chunks)
+		return;
+
+	is_warmed_up = true;
+	warm_up_time = clock::get_seconds_since(warm_up_start);
+	chunk_generation_budget::set_warm_up(false);
+
+	debug::log("[game::world] Warm-up is finished in " + to_string(warm_up_time) + " seconds");
+}
+
+void						world::update_sorting()
+{
+	const auto				camera_position = camera::get_position();
+	const auto				camera_chunk = floor(camera_position / chunk_settings::size_as_vector) * chunk_settings::size_as_vector;
+	const bool				did_camera_cross_chunk = sorting_pivot != camera_chunk;
+
+	engine::clock::ticks	start;
+
+	if (not did_camera_cross_chunk and not should_sort_chunks)
+	{
+		sorting_time = 0.f;
+		return ;
+	}
+
+	start = engine::clock::now();
+
+	if (should_sort_chunks)
+	{
+		chunks_by_distance.clear();
+		for (const auto &[position, chunk] : chunks)
+			chunks_by_distance.push_back(chunk);
+	}
+
+	sort
+	(
+		chunks_by_distance.begin(),
+		chunks_by_distance.end(),
+		[&camera_position](const shared_ptr<chunk> &left, const shared_ptr<chunk> &right)
+		{
+			return glm::distance(left->get_center(), camera_position) > glm::distance(right->get_center(), camera_position);
+		}
+	);
+
+	if (did_camera_cross_chunk)
+	{
+		for (const auto &chunk : chunks_by_distance)
+		{
+			if (glm::distance(chunk->get_center(), camera_position) < world_settings::transparency_sorting_limit)
+				chunk->sort_transparent_quads(camera_position);
+		}
+	}
+
+	sorting_pivot = camera_chunk;
+	should_sort_chunks = false;
+
+	sorting_time = engine::clock::get_seconds_since(start);
+}
+
 void						world::update_chunk_map()
 {
 	chunks.process_added_chunks();
@@ -218,12 +527,16 @@ void						world::destroy_chunk_if_needed(const shared_ptr<chunk> &chunk)
 void 						world::create_chunk(const vec3 &position)
 {
 	chunks.add_later(make_shared<game::chunk>(position));
+	should_sort_chunks = true;
+	number_of_created_chunks++;
 }
 
 void						world::destroy_chunk(const shared_ptr<chunk> &chunk)
 {
 	chunk->delete_build();
 	chunks.remove_later(chunk);
+	should_sort_chunks = true;
+	number_of_destroyed_chunks++;
 }
 
 void 						world::rebuild_chunk(const shared_ptr<chunk> &chunk)
@@ -7,6 +7,9 @@
 #include "game/world/block/block_ptr/block_ptr.h"
 #include "game/world/chunk/chunk/chunk.h"
 #include "game/world/chunk/chunk_map/chunk_map.h"
+#include "game/world/tools/aabb/aabb.h"
+#include "game/world/chunk/occlusion_culler/occlusion_culler.h"
+#include "game/world/far_terrain/far_terrain/far_terrain.h"
 #include "game/world/world/world_settings.h"
 
 #include "application/common/imports/std.h"
@@ -39,11 +42,70 @@ public :
 
 	static bool					does_collide(const aabb &aabb);
 
+	// Returns first contact of box moved by offset with solid blocks, contact time is already backed off by skin
+	static optional<aabb::contact>
+								sweep(const aabb &aabb, const vec3 &offset);
+
+	static float				get_sorting_time();
+
+	static int					get_number_of_rendered_chunks();
+	static int					get_number_of_renderable_chunks();
+
+	static int					get_number_of_created_chunks();
+	static int					get_number_of_destroyed_chunks();
+	static int					get_number_of_chunks();
+
+	// Returns number of chunks with generated model and number of all chunk positions within radius from pivot
+	static pair<int, int>		get_loading_progress(float radius);
+
+	struct						occlusion_sample
+	{
+		int						visible_chunks = 0;
+		int						renderable_chunks = 0;
+		int						visited_sections = 0;
+		float					time = 0.f;
+	};
+
+	// Runs occlusion culling from given position without rendering anything, time is averaged over repetitions
+	static occlusion_sample		measure_occlusion(const vec3 &camera_position, int number_of_repetitions);
+
+	// World is ready when all chunks within warm-up radius are built, player shouldn't act before that
+	static bool					is_ready();
+	static pair<int, int>		get_warm_up_progress();
+
+	// Seconds from start of warm-up to readiness, zero while warm-up isn't finished
+	static float				get_warm_up_time();
+
 private :
 
 	chunk_map					chunks;
 	vec3						pivot;
 
+#if FT_VOX_FAR_TERRAIN
+	far_terrain					far_terrain;
+#endif
+
+#if FT_VOX_OCCLUSION_CULLING
+	occlusion_culler			occlusion_culler;
+#endif
+
+	int							number_of_rendered_chunks;
+	int							number_of_renderable_chunks;
+
+	int							number_of_created_chunks = 0;
+	int							number_of_destroyed_chunks = 0;
+
+	bool						is_warm_up_area_created = false;
+	bool						is_warmed_up = false;
+	engine::clock::ticks		warm_up_start = 0;
+	float						warm_up_time = 0.f;
+
+	vector<shared_ptr<chunk>>	chunks_by_distance;
+	vector<shared_ptr<chunk>>	visible_chunks;
+	optional<vec3>				sorting_pivot;
+	bool						should_sort_chunks;
+	float						sorting_time;
+
 	void						when_initialized() override;
 	void						when_updated() override;
 	void						when_rendered() override;
@@ -51,6 +113,10 @@ private :
 	void 						process_input();
 
 	void						update_pivot();
+	void						update_warm_up();
+
+	static float				get_warm_up_radius();
+	void						update_sorting();
 	void 						update_chunk_map();
 
 	void						update_chunk_build(const shared_ptr<chunk> &chunk);
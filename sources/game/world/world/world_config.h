@@ -0,0 +1,21 @@
+#pragma once
+
+#include "game/world/chunk/generation/utilities/noise/noise_backend.h"
+
+namespace							game
+{
+	struct							world_config;
+}
+
+// Parameters, that define generated world. Unlike world settings, they are chosen at runtime
+// and passed to generators on construction, so same config always produces same world.
+struct								game::world_config
+{
+	int								seed = 21;
+	noise_backend::type				noise_type = noise_backend::type::native;
+
+	const noise_backend				&get_noise_backend() const
+	{
+		return noise_backend::get(noise_type);
+	}
+};
\ No newline at end of file
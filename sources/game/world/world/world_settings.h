@@ -1,5 +1,7 @@
 #pragma once
 
+#include "application/common/defines.h"
+
 namespace							game
 {
 	struct							world_settings;
@@ -7,12 +9,28 @@ namespace							game
 
 struct								game::world_settings
 {
+#if FT_VOX_FAR_TERRAIN
+	// Fog is moved to the end of far terrain
+    static inline array<float, 3>	fog_limit = { 680.f };
+#else
     static inline array<float, 3>	fog_limit = { 200.f };
+#endif
     static inline array<float, 3>	visibility_limit = { 350.f };
     static inline array<float, 3>	cashing_limit = { 350.f };
 
 	static inline int 				current_visibility_option = 0;
 	static inline int 				max_visibility_option = 0;
 
-	static inline float				chunks_generation_time_limit = 1.f / 120.f;
+	// Water quads are re-sorted only in chunks closer than this
+	static inline float				transparency_sorting_limit = 64.f;
+
+	// Collision box is extended by margin, so camera doesn't see through walls
+	static constexpr float			collision_margin = 0.08f;
+
+	// Sweep stops this far from touched face, so sliding along it doesn't snag on neighbor blocks
+	static constexpr float			collision_skin = 0.001f;
+
+	// Chunks closer to spawn than this are built before player gets control, measured same way as limits above.
+	// Radius is clamped, so neighbors of edge chunks fit into caching limit. Zero disables warm-up
+	static inline float				warm_up_radius = 180.f;
 };
\ No newline at end of file